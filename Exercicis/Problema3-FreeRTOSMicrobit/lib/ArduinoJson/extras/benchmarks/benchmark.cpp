@@ -0,0 +1,257 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+// Measures the main operations on representative inputs and prints one JSON
+// object per line, so CI can compare the results from one commit to the next:
+//   {"benchmark":"deserialize","corpus":"telemetry","bytes":35000,
+//    "iterations":1024,"ns_per_op":51234.5,"mb_per_s":683.1,
+//    "allocs_per_op":12}
+//
+// Usage: benchmark [--min-time seconds] [--filter text]
+
+#include <ArduinoJson.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>  // atof
+#include <string.h>  // strcmp
+
+// Counts the calls that reach the heap
+class BenchmarkAllocator : public Allocator {
+ public:
+  virtual ~BenchmarkAllocator() {}
+
+  void* allocate(size_t size) override {
+    count++;
+    return malloc(size);
+  }
+
+  void deallocate(void* ptr) override {
+    free(ptr);
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    count++;
+    return realloc(ptr, newSize);
+  }
+
+  size_t count = 0;
+};
+
+static BenchmarkAllocator allocator;
+
+struct Corpus {
+  std::string name;
+  std::string json;
+};
+
+struct Options {
+  double minTime = 0.5;
+  std::string filter;
+};
+
+struct Measure {
+  size_t iterations;
+  double seconds;
+  size_t allocations;
+};
+
+// Keeps the compiler from removing the work
+static volatile size_t sink;
+
+// Doubles the number of iterations until the run lasts at least minTime
+template <typename TFunction>
+static Measure measure(TFunction f, double minTime) {
+  using clock = std::chrono::steady_clock;
+  f();  // warm up
+  for (size_t n = 1;; n *= 2) {
+    allocator.count = 0;
+    auto start = clock::now();
+    for (size_t i = 0; i < n; i++)
+      f();
+    std::chrono::duration<double> elapsed = clock::now() - start;
+    if (elapsed.count() >= minTime || n >= (size_t(1) << 30))
+      return {n, elapsed.count(), allocator.count};
+  }
+}
+
+// ops is the number of operations per call, bytes the number of bytes
+static void report(const char* benchmark, const std::string& corpus,
+                   size_t bytes, size_t ops, const Measure& m) {
+  double opCount = double(m.iterations) * double(ops);
+  JsonDocument line;
+  line["benchmark"] = benchmark;
+  line["corpus"] = corpus;
+  line["bytes"] = bytes;
+  line["iterations"] = m.iterations;
+  line["ns_per_op"] = m.seconds * 1e9 / opCount;
+  if (bytes)
+    line["mb_per_s"] =
+        double(bytes) * double(m.iterations) / m.seconds / 1e6;
+  line["allocs_per_op"] = double(m.allocations) / opCount;
+  serializeJson(line, std::cout);
+  std::cout << std::endl;
+}
+
+static bool selected(const Options& options, const char* benchmark,
+                     const std::string& corpus) {
+  return options.filter.empty() ||
+         std::string(benchmark).find(options.filter) != std::string::npos ||
+         corpus.find(options.filter) != std::string::npos;
+}
+
+static std::vector<Corpus> loadCorpora() {
+  std::vector<Corpus> corpora;
+
+  // the real-world files of the fuzzer's seed corpus; the others test edge
+  // cases and don't all parse with the default configuration
+  const char* files[] = {"OpenWeatherMap.json", "WeatherUnderground.json"};
+  for (auto file : files) {
+    std::ifstream stream(std::string(CORPUS_DIR) + "/" + file);
+    std::stringstream content;
+    content << stream.rdbuf();
+    if (!content.str().empty())
+      corpora.push_back({file, content.str()});
+    else
+      std::cerr << "Missing " << file << std::endl;
+  }
+
+  // a large array of numbers
+  std::string numbers = "[";
+  for (int i = 0; i < 10000; i++) {
+    if (i)
+      numbers += ",";
+    numbers += i % 2 ? std::to_string(i * 7919) : std::to_string(i) + ".25";
+  }
+  numbers += "]";
+  corpora.push_back({"synthetic_array", numbers});
+
+  // many small objects with the same keys, like device telemetry
+  std::string telemetry = "[";
+  for (int i = 0; i < 200; i++) {
+    if (i)
+      telemetry += ",";
+    telemetry += "{\"device\":\"sensor-" + std::to_string(i % 16) +
+                 "\",\"ts\":" + std::to_string(1700000000000 + i * 1000) +
+                 ",\"seq\":" + std::to_string(i) +
+                 ",\"temp\":21.5,\"hum\":40.25,\"ok\":true,"
+                 "\"tags\":[\"indoor\",\"floor-2\"],"
+                 "\"pos\":{\"lat\":41.3874,\"lon\":2.1686}}";
+  }
+  telemetry += "]";
+  corpora.push_back({"telemetry", telemetry});
+
+  return corpora;
+}
+
+static void benchmarkCorpus(const Corpus& corpus, const Options& options) {
+  JsonDocument doc(&allocator);
+  DeserializationError err = deserializeJson(doc, corpus.json);
+  if (err) {
+    std::cerr << corpus.name << ": " << err.c_str() << std::endl;
+    return;
+  }
+
+  if (selected(options, "deserialize", corpus.name)) {
+    JsonDocument tmp(&allocator);
+    auto m = measure(
+        [&]() {
+          deserializeJson(tmp, corpus.json);
+          sink = tmp.size();
+        },
+        options.minTime);
+    report("deserialize", corpus.name, corpus.json.size(), 1, m);
+  }
+
+  if (selected(options, "serialize", corpus.name)) {
+    std::vector<char> output(measureJson(doc) + 1);
+    auto m = measure(
+        [&]() { sink = serializeJson(doc, output.data(), output.size()); },
+        options.minTime);
+    report("serialize", corpus.name, output.size() - 1, 1, m);
+  }
+
+  if (selected(options, "msgpack_roundtrip", corpus.name)) {
+    std::vector<char> msgpack(measureMsgPack(doc));
+    JsonDocument tmp(&allocator);
+    auto m = measure(
+        [&]() {
+          size_t n = serializeMsgPack(doc, msgpack.data(), msgpack.size());
+          deserializeMsgPack(tmp, msgpack.data(), n);
+          sink = tmp.size();
+        },
+        options.minTime);
+    report("msgpack_roundtrip", corpus.name, msgpack.size(), 1, m);
+  }
+}
+
+// Parses two fields out of eight in each telemetry object
+static void benchmarkFilter(const Corpus& corpus, const Options& options) {
+  if (!selected(options, "filtered_deserialize", corpus.name))
+    return;
+
+  JsonDocument filter;
+  filter[0]["device"] = true;
+  filter[0]["temp"] = true;
+
+  JsonDocument doc(&allocator);
+  auto m = measure(
+      [&]() {
+        deserializeJson(doc, corpus.json,
+                        DeserializationOption::Filter(filter));
+        sink = doc.size();
+      },
+      options.minTime);
+  report("filtered_deserialize", corpus.name, corpus.json.size(), 1, m);
+}
+
+// Looks up three members in each telemetry object
+static void benchmarkLookup(const Corpus& corpus, const Options& options) {
+  if (!selected(options, "member_lookup", corpus.name))
+    return;
+
+  JsonDocument doc(&allocator);
+  deserializeJson(doc, corpus.json);
+  JsonArrayConst objects = doc.as<JsonArrayConst>();
+
+  auto m = measure(
+      [&]() {
+        size_t total = 0;
+        for (JsonObjectConst obj : objects)
+          total += obj["seq"].as<size_t>() + obj["ok"].as<size_t>() +
+                   obj["pos"].size();
+        sink = total;
+      },
+      options.minTime);
+  report("member_lookup", corpus.name, 0, 3 * objects.size(), m);
+}
+
+int main(int argc, const char* argv[]) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+      options.minTime = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      options.filter = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--min-time seconds] [--filter text]" << std::endl;
+      return 1;
+    }
+  }
+
+  for (auto& corpus : loadCorpora()) {
+    benchmarkCorpus(corpus, options);
+    if (corpus.name == "telemetry") {
+      benchmarkFilter(corpus, options);
+      benchmarkLookup(corpus, options);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static void check(const std::string& input, const char* expectedJson) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  CAPTURE(input);
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.as<std::string>() == expectedJson);
+}
+
+TEST_CASE("deserialize CBOR array") {
+  SECTION("definite length") {
+    check("\x80"_s, "[]");
+    check("\x83\x01\x02\x03"_s, "[1,2,3]");
+    check("\x83\x01\x82\x02\x03\x82\x04\x05"_s, "[1,[2,3],[4,5]]");
+    check("\x82\x61\x61\xA1\x61\x62\x61\x63"_s, "[\"a\",{\"b\":\"c\"}]");
+  }
+
+  SECTION("indefinite length") {
+    check("\x9F\xFF"_s, "[]");
+    check("\x9F\x01\x82\x02\x03\x9F\x04\x05\xFF\xFF"_s, "[1,[2,3],[4,5]]");
+    check("\x83\x01\x9F\x02\x03\xFF\x82\x04\x05"_s, "[1,[2,3],[4,5]]");
+  }
+}
+
+TEST_CASE("deserialize CBOR object") {
+  SECTION("definite length") {
+    check("\xA0"_s, "{}");
+    check("\xA2\x61\x61\x01\x61\x62\x82\x02\x03"_s, "{\"a\":1,\"b\":[2,3]}");
+  }
+
+  SECTION("indefinite length") {
+    check("\xBF\xFF"_s, "{}");
+    check("\xBF\x61\x61\x01\x61\x62\x9F\x02\x03\xFF\xFF"_s,
+          "{\"a\":1,\"b\":[2,3]}");
+    check("\xBF\x63"
+          "Fun\xF5\x63"
+          "Amt\x21\xFF"_s,
+          "{\"Fun\":true,\"Amt\":-2}");
+  }
+}
+
+TEST_CASE("deserializeCbor() with a filter") {
+  JsonDocument doc;
+  JsonDocument filter;
+  filter["temp"] = true;
+
+  auto input =
+      "\xA3\x64temp\xF9\x4D\x60\x63raw\x42\x01\x02\x64tags\x9F\x61x"
+      "\xC1\x01\xFF"_s;
+
+  DeserializationError error =
+      deserializeCbor(doc, input, DeserializationOption::Filter(filter));
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.as<std::string>() == "{\"temp\":21.5}");
+}
+
+TEST_CASE("serializeCbor() and deserializeCbor() round trip") {
+  JsonDocument doc;
+  doc["device"] = "sensor-1";
+  doc["seq"] = 42;
+  doc["offset"] = -7;
+  doc["temp"] = 21.5;
+  doc["pressure"] = 1013.25;
+  doc["ratio"] = 0.1;
+  doc["ok"] = true;
+  doc["none"] = nullptr;
+  doc["tags"].add("indoor");
+  doc["ts"] = CborTimestamp(1700000000);
+
+  std::string cbor;
+  serializeCbor(doc, cbor);
+
+  JsonDocument copy;
+  DeserializationError error = deserializeCbor(copy, cbor);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(copy == doc);
+}
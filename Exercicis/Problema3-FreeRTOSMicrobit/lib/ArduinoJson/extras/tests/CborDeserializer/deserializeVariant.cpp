@@ -0,0 +1,186 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <math.h>
+
+#include "Literals.hpp"
+
+template <typename T>
+static void checkValue(const std::string& input, T expected) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  CAPTURE(input);
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.is<T>());
+  REQUIRE(doc.as<T>() == expected);
+}
+
+static void checkNull(const std::string& input) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  CAPTURE(input);
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.isNull());
+}
+
+// The inputs come from Appendix A of RFC 8949
+TEST_CASE("deserialize CBOR value") {
+  SECTION("simple values") {
+    checkValue<bool>("\xF4"_s, false);
+    checkValue<bool>("\xF5"_s, true);
+    checkNull("\xF6"_s);  // null
+    checkNull("\xF7"_s);  // undefined
+    checkNull("\xF0"_s);  // simple(16)
+    checkNull("\xF8\xFF"_s);  // simple(255)
+  }
+
+  SECTION("unsigned integer") {
+    checkValue<int>("\x00"_s, 0);
+    checkValue<int>("\x17"_s, 23);
+    checkValue<int>("\x18\x18"_s, 24);
+    checkValue<int>("\x18\x64"_s, 100);
+    checkValue<int>("\x19\x03\xE8"_s, 1000);
+    checkValue<uint32_t>("\x1A\x00\x0F\x42\x40"_s, 1000000);
+#if ARDUINOJSON_USE_LONG_LONG
+    checkValue<uint64_t>("\x1B\x00\x00\x00\xE8\xD4\xA5\x10\x00"_s,
+                         1000000000000);
+    checkValue<uint64_t>("\x1B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"_s,
+                         18446744073709551615U);
+#else
+    checkNull("\x1B\x00\x00\x00\xE8\xD4\xA5\x10\x00"_s);
+#endif
+  }
+
+  SECTION("negative integer") {
+    checkValue<int>("\x20"_s, -1);
+    checkValue<int>("\x29"_s, -10);
+    checkValue<int>("\x38\x63"_s, -100);
+    checkValue<int>("\x39\x03\xE7"_s, -1000);
+#if ARDUINOJSON_USE_LONG_LONG
+    checkValue<int64_t>("\x3B\x7F\xFF\xFF\xFF\xFF\xFF\xFF\xFF"_s,
+                        -9223372036854775807LL - 1);
+#endif
+    checkNull("\x3B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"_s);  // -2^64
+  }
+
+  SECTION("half precision") {
+    checkValue<double>("\xF9\x00\x00"_s, 0.0);
+    checkValue<double>("\xF9\x3C\x00"_s, 1.0);
+    checkValue<double>("\xF9\x3E\x00"_s, 1.5);
+    checkValue<double>("\xF9\x4D\x60"_s, 21.5);
+    checkValue<double>("\xF9\x7B\xFF"_s, 65504.0);
+    checkValue<double>("\xF9\x00\x01"_s, 5.960464477539063e-8);
+    checkValue<double>("\xF9\x04\x00"_s, 0.00006103515625);
+    checkValue<double>("\xF9\xC4\x00"_s, -4.0);
+
+    JsonDocument doc;
+    deserializeCbor(doc, "\xF9\x80\x00"_s);
+    REQUIRE(signbit(doc.as<double>()));
+    deserializeCbor(doc, "\xF9\x7C\x00"_s);
+    REQUIRE(isinf(doc.as<double>()));
+    deserializeCbor(doc, "\xF9\x7E\x00"_s);
+    REQUIRE(isnan(doc.as<double>()));
+  }
+
+  SECTION("single precision") {
+    checkValue<double>("\xFA\x47\xC3\x50\x00"_s, 100000.0);
+    checkValue<float>("\xFA\x41\xAA\xF5\xC3"_s, 21.37f);
+  }
+
+  SECTION("double precision") {
+    checkValue<double>("\xFB\x3F\xF1\x99\x99\x99\x99\x99\x9A"_s, 1.1);
+    checkValue<double>("\xFB\xC0\x10\x66\x66\x66\x66\x66\x66"_s, -4.1);
+  }
+
+  SECTION("text string") {
+    checkValue<std::string>("\x60"_s, "");
+    checkValue<std::string>("\x64IETF"_s, "IETF");
+    checkValue<std::string>("\x62\xC3\xBC"_s, "\xC3\xBC");
+    checkValue<std::string>("\x78\x18"_s + std::string(24, '?'),
+                            std::string(24, '?'));
+  }
+
+  SECTION("byte string") {
+    JsonDocument doc;
+    auto input = "\x43\x01\x02\x03"_s;
+
+    DeserializationError error = deserializeCbor(doc, input);
+
+    REQUIRE(error == DeserializationError::Ok);
+    std::string output;
+    serializeCbor(doc, output);
+    REQUIRE(output == input);
+  }
+}
+
+TEST_CASE("deserialize CBOR tags") {
+  JsonDocument doc;
+
+  SECTION("epoch timestamp") {
+    auto input = "\xC1\x1A\x51\x4B\x67\xB0"_s;
+
+    DeserializationError error = deserializeCbor(doc, input);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.is<CborTimestamp>());
+    REQUIRE(doc.as<CborTimestamp>().seconds() == 1363896240);
+    std::string output;
+    serializeCbor(doc, output);
+    REQUIRE(output == input);
+  }
+
+  SECTION("negative epoch timestamp") {
+    DeserializationError error = deserializeCbor(doc, "\xC1\x38\x63"_s);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<CborTimestamp>().seconds() == -100);
+  }
+
+  SECTION("tag 1 in its long form") {
+    DeserializationError error = deserializeCbor(doc, "\xD8\x01\x05"_s);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<CborTimestamp>().seconds() == 5);
+  }
+
+  SECTION("tag 1 on a float") {
+    DeserializationError error =
+        deserializeCbor(doc, "\xC1\xFB\x41\xD4\x52\xD9\xEC\x20\x00\x00"_s);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.is<CborTimestamp>() == false);
+    REQUIRE(doc.as<double>() == 1363896240.5);
+  }
+
+  SECTION("date/time string") {
+    DeserializationError error =
+        deserializeCbor(doc, "\xC0\x74"
+                             "2013-03-21T20:04:00Z"_s);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "2013-03-21T20:04:00Z");
+  }
+
+  SECTION("other tags are dropped") {
+    DeserializationError error =
+        deserializeCbor(doc, "\xD8\x20\xD8\x20\x63www"_s);
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "www");
+  }
+
+  SECTION("not a timestamp") {
+    REQUIRE(doc.is<CborTimestamp>() == false);
+    doc.set(42);
+    REQUIRE(doc.is<CborTimestamp>() == false);
+    REQUIRE(doc.as<CborTimestamp>().seconds() == 0);
+  }
+}
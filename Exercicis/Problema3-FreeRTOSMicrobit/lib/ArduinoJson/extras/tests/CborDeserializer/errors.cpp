@@ -0,0 +1,111 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+static void checkError(const std::string& input,
+                       DeserializationError expected) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  CAPTURE(input);
+  REQUIRE(error == expected);
+}
+
+TEST_CASE("deserializeCbor() returns EmptyInput") {
+  JsonDocument doc;
+
+  SECTION("from sized buffer") {
+    auto err = deserializeCbor(doc, "", 0);
+
+    REQUIRE(err == DeserializationError::EmptyInput);
+  }
+
+  SECTION("from stream") {
+    std::istringstream input("");
+
+    auto err = deserializeCbor(doc, input);
+
+    REQUIRE(err == DeserializationError::EmptyInput);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns IncompleteInput") {
+  auto incomplete = DeserializationError::IncompleteInput;
+
+  checkError("\x18"_s, incomplete);
+  checkError("\x19\x03"_s, incomplete);
+  checkError("\xF9\x3C"_s, incomplete);
+  checkError("\xFA\x47\xC3\x50"_s, incomplete);
+  checkError("\xFB\x3F\xF1\x99\x99\x99\x99\x99"_s, incomplete);
+  checkError("\x64IET"_s, incomplete);
+  checkError("\x43\x01\x02"_s, incomplete);
+  checkError("\x83\x01\x02"_s, incomplete);
+  checkError("\x9F\x01\x02"_s, incomplete);
+  checkError("\xA1\x61\x61"_s, incomplete);
+  checkError("\xBF\x61\x61\x01"_s, incomplete);
+  checkError("\xC1"_s, incomplete);
+  checkError("\xC1\x1A\x51\x4B"_s, incomplete);
+}
+
+TEST_CASE("deserializeCbor() returns InvalidInput") {
+  auto invalid = DeserializationError::InvalidInput;
+
+  SECTION("reserved additional information") {
+    checkError("\x1C"_s, invalid);
+    checkError("\x3D"_s, invalid);
+    checkError("\xFC"_s, invalid);
+  }
+
+  SECTION("indefinite length integer or tag") {
+    checkError("\x1F"_s, invalid);
+    checkError("\xDF\x01"_s, invalid);
+  }
+
+  SECTION("break outside of an indefinite-length item") {
+    checkError("\xFF"_s, invalid);
+    checkError("\x82\x01\xFF"_s, invalid);
+  }
+
+  SECTION("key that isn't a text string") {
+    checkError("\xA1\x01\x02"_s, invalid);
+  }
+
+  SECTION("indefinite-length strings are not supported") {
+    checkError("\x7F\x61\x61\xFF"_s, invalid);
+    checkError("\x5F\x41\x01\xFF"_s, invalid);
+    checkError("\xA1\x7F\x61\x61\xFF\x01"_s, invalid);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns NoMemory") {
+  TimebombAllocator timebomb(0);
+  JsonDocument doc(&timebomb);
+
+  SECTION("array") {
+    auto err = deserializeCbor(doc, "\x81\x01"_s);
+    REQUIRE(err == DeserializationError::NoMemory);
+  }
+
+  SECTION("string") {
+    auto err = deserializeCbor(doc, "\x61\x61"_s);
+    REQUIRE(err == DeserializationError::NoMemory);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns TooDeep") {
+  JsonDocument doc;
+
+  auto err = deserializeCbor(doc, "\x81\x81\x80"_s,
+                             DeserializationOption::NestingLimit(1));
+
+  REQUIRE(err == DeserializationError::TooDeep);
+}
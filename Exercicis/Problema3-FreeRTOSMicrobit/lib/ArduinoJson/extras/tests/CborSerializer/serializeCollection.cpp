@@ -0,0 +1,96 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static void check(JsonVariantConst variant, const std::string& expected) {
+  std::string actual;
+  size_t len = serializeCbor(variant, actual);
+  CAPTURE(variant);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("serialize CBOR array") {
+  JsonDocument doc;
+  JsonArray array = doc.to<JsonArray>();
+
+  SECTION("empty") {
+    check(array, "\x80"_s);
+  }
+
+  SECTION("[1, [2, 3], [4, 5]]") {
+    array.add(1);
+    JsonArray nested = array.add<JsonArray>();
+    nested.add(2);
+    nested.add(3);
+    nested = array.add<JsonArray>();
+    nested.add(4);
+    nested.add(5);
+
+    check(array, "\x83\x01\x82\x02\x03\x82\x04\x05"_s);
+  }
+
+  SECTION("25 elements") {
+    std::string expected = "\x98\x19"_s;
+    for (int i = 1; i <= 25; i++) {
+      array.add(i);
+      expected += i < 24 ? std::string(1, char(i))
+                         : "\x18"_s + std::string(1, char(i));
+    }
+
+    check(array, expected);
+  }
+}
+
+TEST_CASE("serialize CBOR object") {
+  JsonDocument doc;
+  JsonObject object = doc.to<JsonObject>();
+
+  SECTION("empty") {
+    check(object, "\xA0"_s);
+  }
+
+  SECTION("{\"a\": 1, \"b\": [2, 3]}") {
+    object["a"] = 1;
+    JsonArray b = object["b"].to<JsonArray>();
+    b.add(2);
+    b.add(3);
+
+    check(object, "\xA2\x61\x61\x01\x61\x62\x82\x02\x03"_s);
+  }
+
+  SECTION("telemetry frame") {
+    object["temp"] = 21.5f;
+    object["ts"] = CborTimestamp(1700000000);
+
+    check(object,
+          "\xA2\x64temp\xF9\x4D\x60\x62ts\xC1\x1A\x65\x53\xF1\x00"_s);
+    REQUIRE(measureCbor(doc) < measureJson(doc));
+  }
+}
+
+TEST_CASE("serializeCbor(JsonVariantConst, void*, size_t)") {
+  JsonDocument doc;
+  doc.add(true);
+  doc.add("hello");
+
+  SECTION("large enough") {
+    char buffer[8];
+    size_t len = serializeCbor(doc, buffer, sizeof(buffer));
+
+    REQUIRE(len == 8);
+    REQUIRE(std::string(buffer, len) == "\x82\xF5\x65hello"_s);
+  }
+
+  SECTION("too small") {
+    char buffer[4];
+    size_t len = serializeCbor(doc, buffer, sizeof(buffer));
+
+    REQUIRE(len == 4);
+  }
+}
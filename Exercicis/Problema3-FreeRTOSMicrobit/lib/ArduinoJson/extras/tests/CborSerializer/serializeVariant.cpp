@@ -0,0 +1,115 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <limits>
+
+#include "Literals.hpp"
+
+template <typename T>
+static void checkVariant(T value, const std::string& expected) {
+  JsonDocument doc;
+  JsonVariant variant = doc.to<JsonVariant>();
+  variant.set(value);
+  std::string actual;
+  size_t len = serializeCbor(variant, actual);
+  CAPTURE(variant);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+  REQUIRE(measureCbor(variant) == expected.size());
+}
+
+// The expected values come from Appendix A of RFC 8949
+TEST_CASE("serialize CBOR value") {
+  SECTION("unbound") {
+    checkVariant(JsonVariant(), "\xF6"_s);
+  }
+
+  SECTION("null") {
+    checkVariant(nullptr, "\xF6"_s);
+  }
+
+  SECTION("bool") {
+    checkVariant(false, "\xF4"_s);
+    checkVariant(true, "\xF5"_s);
+  }
+
+  SECTION("unsigned integer") {
+    checkVariant(0, "\x00"_s);
+    checkVariant(23, "\x17"_s);
+    checkVariant(24, "\x18\x18"_s);
+    checkVariant(100U, "\x18\x64"_s);
+    checkVariant(1000, "\x19\x03\xE8"_s);
+    checkVariant(1000000, "\x1A\x00\x0F\x42\x40"_s);
+#if ARDUINOJSON_USE_LONG_LONG
+    checkVariant(1000000000000, "\x1B\x00\x00\x00\xE8\xD4\xA5\x10\x00"_s);
+    checkVariant(18446744073709551615U,
+                 "\x1B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"_s);
+#endif
+  }
+
+  SECTION("negative integer") {
+    checkVariant(-1, "\x20"_s);
+    checkVariant(-10, "\x29"_s);
+    checkVariant(-100, "\x38\x63"_s);
+    checkVariant(-1000, "\x39\x03\xE7"_s);
+#if ARDUINOJSON_USE_LONG_LONG
+    checkVariant(std::numeric_limits<int64_t>::min(),
+                 "\x3B\x7F\xFF\xFF\xFF\xFF\xFF\xFF\xFF"_s);
+#endif
+  }
+
+  SECTION("half precision") {
+    checkVariant(0.0, "\xF9\x00\x00"_s);
+    checkVariant(-0.0, "\xF9\x80\x00"_s);
+    checkVariant(1.0, "\xF9\x3C\x00"_s);
+    checkVariant(1.5, "\xF9\x3E\x00"_s);
+    checkVariant(21.5f, "\xF9\x4D\x60"_s);
+    checkVariant(65504.0, "\xF9\x7B\xFF"_s);
+    checkVariant(-4.0, "\xF9\xC4\x00"_s);
+    checkVariant(5.960464477539063e-8, "\xF9\x00\x01"_s);  // subnormal
+    checkVariant(0.00006103515625, "\xF9\x04\x00"_s);
+    checkVariant(std::numeric_limits<double>::infinity(), "\xF9\x7C\x00"_s);
+    checkVariant(-std::numeric_limits<double>::infinity(), "\xF9\xFC\x00"_s);
+    checkVariant(std::numeric_limits<double>::quiet_NaN(), "\xF9\x7E\x00"_s);
+  }
+
+  SECTION("single precision") {
+    checkVariant(100000.0, "\xFA\x47\xC3\x50\x00"_s);
+    checkVariant(3.4028234663852886e+38, "\xFA\x7F\x7F\xFF\xFF"_s);
+    checkVariant(21.37f, "\xFA\x41\xAA\xF5\xC3"_s);
+    checkVariant(65520.0, "\xFA\x47\x7F\xF0\x00"_s);
+  }
+
+#if ARDUINOJSON_USE_DOUBLE
+  SECTION("double precision") {
+    checkVariant(1.1, "\xFB\x3F\xF1\x99\x99\x99\x99\x99\x9A"_s);
+    checkVariant(-4.1, "\xFB\xC0\x10\x66\x66\x66\x66\x66\x66"_s);
+    checkVariant(1.0e+300, "\xFB\x7E\x37\xE4\x3C\x88\x00\x75\x9C"_s);
+  }
+#endif
+
+  SECTION("text string") {
+    checkVariant("", "\x60"_s);
+    checkVariant("a", "\x61\x61"_s);
+    checkVariant("IETF", "\x64IETF"_s);
+    checkVariant("\xC3\xBC", "\x62\xC3\xBC"_s);
+    checkVariant(std::string(24, '?'), "\x78\x18"_s + std::string(24, '?'));
+    checkVariant(std::string(256, '?'),
+                 "\x79\x01\x00"_s + std::string(256, '?'));
+  }
+
+  SECTION("serialized(const char*)") {
+    checkVariant(serialized("\x43\x01\x02\x03"), "\x43\x01\x02\x03"_s);
+  }
+
+  SECTION("CborTimestamp") {
+    checkVariant(CborTimestamp(1363896240), "\xC1\x1A\x51\x4B\x67\xB0"_s);
+    checkVariant(CborTimestamp(0), "\xC1\x00"_s);
+    checkVariant(CborTimestamp(-1), "\xC1\x20"_s);
+    checkVariant(CborTimestamp(-100), "\xC1\x38\x63"_s);
+  }
+}
@@ -0,0 +1,68 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson.hpp>
+#include <sstream>
+#include <string>
+
+// Records the events of parseJson() and parseMsgPack() in a string
+class EventLogger : public ArduinoJson::JsonEventHandler {
+ public:
+  void onStartObject() {
+    log_ << "{";
+  }
+
+  void onKey(ArduinoJson::JsonString key) {
+    log_ << "key(" << key.c_str() << ")";
+  }
+
+  void onEndObject() {
+    log_ << "}";
+  }
+
+  void onStartArray() {
+    log_ << "[";
+  }
+
+  void onEndArray() {
+    log_ << "]";
+  }
+
+  void onNull() {
+    log_ << "null ";
+  }
+
+  void onBoolean(bool value) {
+    log_ << (value ? "true " : "false ");
+  }
+
+  void onInteger(ArduinoJson::JsonInteger value) {
+    log_ << "int(" << value << ")";
+  }
+
+  void onUnsignedInteger(ArduinoJson::JsonUInt value) {
+    log_ << "uint(" << value << ")";
+  }
+
+  void onFloat(ArduinoJson::JsonFloat value) {
+    log_ << "float(" << value << ")";
+  }
+
+  void onString(ArduinoJson::JsonString value) {
+    log_ << "str(" << std::string(value.c_str(), value.size()) << ")";
+  }
+
+  void onRawString(ArduinoJson::JsonString value) {
+    log_ << "raw(" << value.size() << ")";
+  }
+
+  std::string str() const {
+    return log_.str();
+  }
+
+ private:
+  std::ostringstream log_;
+};
@@ -0,0 +1,109 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "Allocators.hpp"
+#include "EventLogger.hpp"
+
+TEST_CASE("parseJson()") {
+  EventLogger logger;
+
+  SECTION("values") {
+    DeserializationError err =
+        parseJson("[null,true,false,42,-42,3.5,\"hi\\n\"]", logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() ==
+            "[null true false uint(42)int(-42)float(3.5)str(hi\n)]");
+  }
+
+  SECTION("nested objects and arrays") {
+    DeserializationError err =
+        parseJson("{\"a\":[1,{}],'b':{c:[]}, \"d\" : \"e\"}", logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() ==
+            "{key(a)[uint(1){}]key(b){key(c)[]}key(d)str(e)}");
+  }
+
+  SECTION("std::istream") {
+    std::istringstream json("{\"hello\":\"world\"}");
+
+    DeserializationError err = parseJson(json, logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "{key(hello)str(world)}");
+  }
+
+  SECTION("char* and size") {
+    char json[] = "[1,2]garbage";
+
+    DeserializationError err = parseJson(json, 5, logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "[uint(1)uint(2)]");
+  }
+
+  SECTION("errors are reported after the events that precede them") {
+    DeserializationError err = parseJson("[1,2,", logger);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(logger.str() == "[uint(1)uint(2)");
+  }
+
+  SECTION("invalid input") {
+    REQUIRE(parseJson("[1,]", logger) == DeserializationError::InvalidInput);
+    REQUIRE(parseJson("{\"a\" 1}", logger) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(parseJson("", logger) == DeserializationError::EmptyInput);
+  }
+
+  SECTION("trailing characters") {
+    // same as deserializeJson()
+    REQUIRE(parseJson("42x", logger) == DeserializationError::InvalidInput);
+    REQUIRE(parseJson("1.5 x", logger) == DeserializationError::InvalidInput);
+    REQUIRE(parseJson("{}garbage", logger) == DeserializationError::Ok);
+    REQUIRE(parseJson("true x", logger) == DeserializationError::Ok);
+  }
+
+  SECTION("allocator") {
+    SpyingAllocator spy;
+
+    DeserializationError err = parseJson("[\"hello\"]", logger, &spy);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "[str(hello)]");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofStringBuffer()),
+                             Deallocate(sizeofStringBuffer()),
+                         });
+  }
+
+  SECTION("nesting limit") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(parseJson("[1]", logger, nesting) == DeserializationError::Ok);
+    REQUIRE(parseJson("[[1]]", logger, nesting) ==
+            DeserializationError::TooDeep);
+  }
+
+  SECTION("handler with only a few functions") {
+    struct Counter : JsonEventHandler {
+      int count = 0;
+
+      void onUnsignedInteger(JsonUInt) {
+        count++;
+      }
+    } counter;
+
+    DeserializationError err = parseJson("[1,\"2\",[3,{\"x\":4}]]", counter);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(counter.count == 3);
+  }
+}
@@ -0,0 +1,117 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+namespace {
+struct Command {
+  int id = 0;
+  uint8_t speed = 0;
+  float ratio = 0;
+  bool enabled = false;
+  char name[8] = "";
+  std::string comment;
+};
+}  // namespace
+
+ARDUINOJSON_FIELDS_BEGIN(Command)
+ARDUINOJSON_FIELD(id)
+ARDUINOJSON_FIELD_NAMED(speed, "spd")
+ARDUINOJSON_FIELD(ratio)
+ARDUINOJSON_FIELD(enabled)
+ARDUINOJSON_FIELD(name)
+ARDUINOJSON_FIELD(comment)
+ARDUINOJSON_FIELDS_END()
+
+TEST_CASE("parseJson(JsonStructHandler)") {
+  Command cmd;
+  JsonStructHandler<Command> handler(cmd);
+
+  SECTION("all fields") {
+    DeserializationError err = parseJson(
+        "{\"id\":-42,\"spd\":200,\"ratio\":0.5,\"enabled\":true,"
+        "\"name\":\"motor\",\"comment\":\"left wheel\"}",
+        handler);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.fieldCount() == 6);
+    REQUIRE(cmd.id == -42);
+    REQUIRE(cmd.speed == 200);
+    REQUIRE(cmd.ratio == 0.5f);
+    REQUIRE(cmd.enabled == true);
+    REQUIRE(cmd.name == std::string("motor"));
+    REQUIRE(cmd.comment == "left wheel");
+  }
+
+  SECTION("unknown keys are skipped") {
+    DeserializationError err = parseJson(
+        "{\"speed\":1,\"x\":{\"id\":2,\"ratio\":[3]},\"idx\":4,\"id\":5}",
+        handler);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.fieldCount() == 1);
+    REQUIRE(cmd.id == 5);
+    REQUIRE(cmd.speed == 0);
+    REQUIRE(cmd.ratio == 0);
+  }
+
+  SECTION("mismatched values are skipped") {
+    DeserializationError err = parseJson(
+        "{\"id\":\"1\",\"spd\":256,\"enabled\":1,\"name\":\"too long!\","
+        "\"comment\":42,\"ratio\":null}",
+        handler);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.fieldCount() == 0);
+    REQUIRE(cmd.id == 0);
+    REQUIRE(cmd.speed == 0);
+    REQUIRE(cmd.enabled == false);
+    REQUIRE(cmd.name == std::string(""));
+    REQUIRE(cmd.comment == "");
+  }
+
+  SECTION("arrays and objects under a known key are skipped") {
+    DeserializationError err =
+        parseJson("{\"id\":[1,{\"id\":2}],\"spd\":{\"spd\":3},\"ratio\":4}",
+                  handler);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.fieldCount() == 1);
+    REQUIRE(cmd.id == 0);
+    REQUIRE(cmd.speed == 0);
+    REQUIRE(cmd.ratio == 4);
+  }
+
+  SECTION("root is not an object") {
+    DeserializationError err = parseJson("[{\"id\":1},2]", handler);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.fieldCount() == 0);
+    REQUIRE(cmd.id == 0);
+  }
+
+  SECTION("errors are reported") {
+    DeserializationError err = parseJson("{\"id\":1,", handler);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(cmd.id == 1);
+  }
+}
+
+TEST_CASE("parseMsgPack(JsonStructHandler)") {
+  Command cmd;
+  JsonStructHandler<Command> handler(cmd);
+
+  DeserializationError err = parseMsgPack(
+      "\x83\xA2id\xD0\xD6\xA3spd\xCC\xC8\xA4name\xA5motor", handler);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(handler.fieldCount() == 3);
+  REQUIRE(cmd.id == -42);
+  REQUIRE(cmd.speed == 200);
+  REQUIRE(cmd.name == std::string("motor"));
+}
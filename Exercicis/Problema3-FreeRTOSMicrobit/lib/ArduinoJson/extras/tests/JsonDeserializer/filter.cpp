@@ -721,6 +721,18 @@ TEST_CASE("Filtering") {
 
       doc.shrinkToFit();
       CHECK(spy.allocatedBytes() == tc.memoryUsage);
+
+      // the compiled filter must behave exactly like the original
+      JsonDocument doc2;
+      DeserializationOption::CompiledFilter compiled(filter);
+      REQUIRE(compiled.overflowed() == false);
+
+      CHECK(deserializeJson(
+                doc2, tc.input, compiled,
+                DeserializationOption::NestingLimit(tc.nestingLimit)) ==
+            tc.error);
+
+      CHECK(doc2.as<std::string>() == tc.output);
     }
   }
 }
@@ -829,3 +841,98 @@ TEST_CASE("shrink filter") {
                            Reallocate(sizeofPool(), sizeofObject(1)),
                        });
 }
+
+TEST_CASE("Back-slash at the end of a skipped string") {
+  JsonDocument doc;
+  JsonDocument filter;
+  filter["b"] = true;
+
+  // allocate the exact size, so that reading past the terminator is detected
+  const char json[] = "{\"a\":\"\\";
+  char* input = new char[sizeof(json)];
+  memcpy(input, json, sizeof(json));
+
+  SECTION("null-terminated input") {
+    DeserializationError err =
+        deserializeJson(doc, input, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("input with a size") {
+    DeserializationError err = deserializeJson(
+        doc, input, sizeof(json) - 1, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  delete[] input;
+}
+
+TEST_CASE("CompiledFilter") {
+  JsonDocument doc;
+  JsonDocument filter;
+
+  SECTION("can be reused") {
+    filter["list"][0]["id"] = true;
+    DeserializationOption::CompiledFilter compiled(filter);
+    filter.clear();  // the compiled filter doesn't depend on the original
+
+    REQUIRE(deserializeJson(doc, "{\"list\":[{\"id\":1,\"x\":2}],\"y\":3}",
+                            compiled) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"list\":[{\"id\":1}]}");
+
+    REQUIRE(deserializeJson(doc, "{\"y\":3,\"list\":[{\"id\":4},{\"id\":5}]}",
+                            compiled) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"list\":[{\"id\":4},{\"id\":5}]}");
+  }
+
+  SECTION("many keys") {
+    for (int i = 0; i < 100; i++)
+      filter["key" + std::to_string(i)] = true;
+    DeserializationOption::CompiledFilter compiled(filter);
+
+    REQUIRE(deserializeJson(doc,
+                            "{\"key42\":1,\"key100\":2,\"key7\":3,\"k\":4}",
+                            compiled) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"key42\":1,\"key7\":3}");
+  }
+
+  SECTION("with deserializeMsgPack()") {
+    filter["a"] = true;
+    DeserializationOption::CompiledFilter compiled(filter);
+
+    REQUIRE(deserializeMsgPack(doc, "\x82\xA1\x61\x01\xA1\x62\x02",
+                               compiled) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"a\":1}");
+  }
+
+  SECTION("uses the allocator once") {
+    filter["a"]["b"] = true;
+    filter["c"] = true;
+    SpyingAllocator spy;
+
+    {
+      DeserializationOption::CompiledFilter compiled(filter, &spy);
+      deserializeJson(doc, "{\"a\":{\"b\":1},\"c\":2}", compiled);
+    }
+
+    using namespace ArduinoJson::detail;
+    size_t size = 3 * sizeof(FilterMember) + 5 * sizeof(FilterNode) + 3;
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(size),
+                             Deallocate(size),
+                         });
+  }
+
+  SECTION("allocation failure") {
+    filter["a"] = true;
+    TimebombAllocator timebomb(0);
+    DeserializationOption::CompiledFilter compiled(filter, &timebomb);
+
+    REQUIRE(compiled.overflowed() == true);
+    REQUIRE(deserializeJson(doc, "{\"a\":1}", compiled) ==
+            DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+  }
+}
@@ -0,0 +1,245 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_COMMENTS 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+static DeserializationError feed(JsonIncrementalParser& parser,
+                                 const char* s) {
+  return parser.feed(s, strlen(s));
+}
+
+TEST_CASE("JsonIncrementalParser") {
+  JsonDocument doc;
+  JsonIncrementalParser parser(doc);
+
+  SECTION("object fed in one go") {
+    REQUIRE(feed(parser, "{\"a\":1}") == DeserializationError::Ok);
+    REQUIRE(parser.consumed() == 7);
+    REQUIRE(doc.as<std::string>() == "{\"a\":1}");
+  }
+
+  SECTION("object fed one byte at a time") {
+    const char* input =
+        "{\"a\":[1,2.5,-3],\"b\":\"x}\\\"]\\u00e9\\uD83D\\uDE00\",'c':{}, "
+        "d : [true,false,null] , \"a\":\"again\"}";
+    size_t n = strlen(input);
+
+    for (size_t i = 0; i < n - 1; i++)
+      REQUIRE(parser.feed(input + i, 1) ==
+              DeserializationError::IncompleteInput);
+    REQUIRE(parser.feed(input + n - 1, 1) == DeserializationError::Ok);
+
+    REQUIRE(doc.as<std::string>() ==
+            "{\"a\":\"again\",\"b\":\"x}\\\"]\xC3\xA9\xF0\x9F\x98\x80\","
+            "\"c\":{},\"d\":[true,false,null]}");
+  }
+
+  SECTION("values are stored as soon as they are complete") {
+    REQUIRE(feed(parser, "{\"a\":[1,2],\"b\":\"hel") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(doc["a"].as<std::string>() == "[1,2]");
+
+    REQUIRE(feed(parser, "lo\"}") == DeserializationError::Ok);
+    REQUIRE(doc["b"] == "hello");
+  }
+
+  SECTION("nothing") {
+    REQUIRE(parser.feed(nullptr, 0) == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("whitespace only") {
+    REQUIRE(feed(parser, " \r\n\t") == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("top-level string") {
+    REQUIRE(feed(parser, " \"hel") == DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, "lo\"") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "hello");
+  }
+
+  SECTION("top-level number needs a delimiter") {
+    REQUIRE(feed(parser, "12") == DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, "34") == DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, "\n") == DeserializationError::Ok);
+    REQUIRE(parser.consumed() == 0);
+    REQUIRE(doc.as<int>() == 1234);
+  }
+
+  SECTION("finish() completes a top-level number") {
+    REQUIRE(feed(parser, "12") == DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, "34") == DeserializationError::IncompleteInput);
+    REQUIRE(parser.finish() == DeserializationError::Ok);
+    REQUIRE(doc.as<int>() == 1234);
+
+    REQUIRE(feed(parser, "[5]") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[5]");
+  }
+
+  SECTION("finish() rejects an invalid top-level number") {
+    REQUIRE(feed(parser, "1-2") == DeserializationError::IncompleteInput);
+    REQUIRE(parser.finish() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("finish() without a document") {
+    REQUIRE(parser.finish() == DeserializationError::EmptyInput);
+    REQUIRE(feed(parser, " // comment") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(parser.finish() == DeserializationError::EmptyInput);
+  }
+
+  SECTION("finish() after a complete document") {
+    REQUIRE(feed(parser, "{}") == DeserializationError::Ok);
+    REQUIRE(parser.finish() == DeserializationError::EmptyInput);
+    REQUIRE(doc.as<std::string>() == "{}");
+  }
+
+  SECTION("finish() in a truncated document") {
+    REQUIRE(feed(parser, "[12") == DeserializationError::IncompleteInput);
+    REQUIRE(parser.finish() == DeserializationError::IncompleteInput);
+
+    REQUIRE(feed(parser, "[3]") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[3]");
+  }
+
+  SECTION("top-level literal followed by an array") {
+    REQUIRE(feed(parser, "true[1]") == DeserializationError::Ok);
+    REQUIRE(parser.consumed() == 4);
+    REQUIRE(doc.as<bool>() == true);
+
+    REQUIRE(feed(parser, "[1]") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[1]");
+  }
+
+  SECTION("several documents in one feed") {
+    const char* input = "{\"id\":1}\n{\"id\":2}\n{\"id";
+
+    REQUIRE(feed(parser, input) == DeserializationError::Ok);
+    REQUIRE(parser.consumed() == 8);
+    REQUIRE(doc["id"] == 1);
+
+    input += parser.consumed();
+    REQUIRE(feed(parser, input) == DeserializationError::Ok);
+    REQUIRE(parser.consumed() == 9);
+    REQUIRE(doc["id"] == 2);
+
+    input += parser.consumed();
+    REQUIRE(feed(parser, input) == DeserializationError::IncompleteInput);
+    REQUIRE(parser.consumed() == 5);
+    REQUIRE(feed(parser, "\":3}") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"id\":3}");
+  }
+
+  SECTION("comments") {
+    REQUIRE(feed(parser, "/* { */ [1, // ]\n 2 /*") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, "*]*/ ]") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[1,2]");
+  }
+
+  SECTION("unexpected closing bracket") {
+    REQUIRE(feed(parser, "]") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "[1}") == DeserializationError::InvalidInput);
+    REQUIRE(parser.consumed() == 2);
+  }
+
+  SECTION("invalid content") {
+    REQUIRE(feed(parser, "[1,}") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "{\"a\" 1}") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "[tru ]") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "[\"\\x\"]") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "[\"\\u12G4\"]") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("the parser recovers after an error") {
+    REQUIRE(feed(parser, "/x") == DeserializationError::InvalidInput);
+    REQUIRE(feed(parser, "[42]") == DeserializationError::Ok);
+    REQUIRE(doc[0] == 42);
+  }
+
+  SECTION("reset() discards the incomplete document") {
+    REQUIRE(feed(parser, "[1,2") == DeserializationError::IncompleteInput);
+    parser.reset();
+    REQUIRE(feed(parser, "[3]") == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[3]");
+  }
+}
+
+TEST_CASE("JsonIncrementalParser nesting limit") {
+  JsonDocument doc;
+
+  SECTION("limit reached") {
+    JsonIncrementalParser parser(doc, DeserializationOption::NestingLimit(1));
+
+    REQUIRE(feed(parser, "[[") == DeserializationError::TooDeep);
+  }
+
+  SECTION("limit not reached") {
+    JsonIncrementalParser parser(doc, DeserializationOption::NestingLimit(2));
+
+    REQUIRE(feed(parser, "[[]]") == DeserializationError::Ok);
+  }
+}
+
+TEST_CASE("JsonIncrementalParser allocations") {
+  TimebombAllocator timebomb(100);
+  SpyingAllocator spy(&timebomb);
+  JsonDocument doc(&spy);
+  size_t stackSize = ARDUINOJSON_DEFAULT_NESTING_LIMIT * sizeof(void*);
+
+  SECTION("the stack comes from the document's allocator") {
+    {
+      JsonIncrementalParser parser(doc);
+      REQUIRE(feed(parser, "[1") == DeserializationError::IncompleteInput);
+      REQUIRE(spy.log() == AllocatorLog{
+                               Allocate(stackSize),
+                               Allocate(sizeofPool()),
+                           });
+    }
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(stackSize),
+                             Allocate(sizeofPool()),
+                             Deallocate(stackSize),
+                         });
+  }
+
+  SECTION("the input isn't copied") {
+    JsonIncrementalParser parser(doc);
+
+    REQUIRE(feed(parser, "\"hello") == DeserializationError::IncompleteInput);
+    REQUIRE(feed(parser, " world\"") == DeserializationError::Ok);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofStringBuffer()),
+                             Reallocate(sizeofStringBuffer(),
+                                        sizeofString("hello world")),
+                         });
+  }
+
+  SECTION("stack allocation failure") {
+    JsonIncrementalParser parser(doc);
+    timebomb.setCountdown(0);
+
+    REQUIRE(feed(parser, "[1]") == DeserializationError::NoMemory);
+    REQUIRE(spy.log() == AllocatorLog{
+                             AllocateFail(stackSize),
+                         });
+  }
+
+  SECTION("slot allocation failure") {
+    JsonIncrementalParser parser(doc);
+    timebomb.setCountdown(1);
+
+    REQUIRE(feed(parser, "[1]") == DeserializationError::NoMemory);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(stackSize),
+                             AllocateFail(sizeofPool()),
+                         });
+  }
+}
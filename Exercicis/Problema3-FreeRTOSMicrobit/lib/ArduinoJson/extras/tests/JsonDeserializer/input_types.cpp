@@ -34,6 +34,81 @@ TEST_CASE("deserializeJson(char*)") {
           });
 }
 
+TEST_CASE("deserializeJson(inPlace(char*))") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("stores pointers to the input") {
+    char input[] = "{\"hello\":\"world\"}";
+
+    DeserializationError err = deserializeJson(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"hello\":\"world\"}");
+    REQUIRE(doc["hello"].as<const char*>() == input + 6);
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() == input);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofObject(1)),
+                         });
+  }
+
+  SECTION("decodes escape sequences") {
+    char input[] = "[\"1\\n2\",\"\\u00e9\\t\",'\\\"']";
+
+    DeserializationError err = deserializeJson(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "1\n2");
+    REQUIRE(doc[1] == "\xC3\xA9\t");
+    REQUIRE(doc[2] == "\"");
+  }
+
+  SECTION("supports non-quoted keys and duplicate keys") {
+    char input[] = "{a:1,bb:2,a:3}";
+
+    DeserializationError err = deserializeJson(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"a\":3,\"bb\":2}");
+  }
+
+  SECTION("copies strings containing NUL") {
+    char input[] = "[\"a\\u0000b\",\"c\"]";
+
+    DeserializationError err = deserializeJson(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0].as<std::string>() == "a\0b"_s);
+    REQUIRE(doc[0].as<JsonString>().isStatic() == false);
+    REQUIRE(doc[1].as<JsonString>().isStatic() == true);
+  }
+
+  SECTION("with size") {
+    char input[] = "[\"hello\",\"world\"]garbage";
+
+    DeserializationError err = deserializeJson(doc, inPlace(input, 17));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[\"hello\",\"world\"]");
+  }
+
+  SECTION("incomplete input") {
+    char input[] = "[\"hello\",\"wor";
+
+    DeserializationError err =
+        deserializeJson(doc, inPlace(input, strlen(input)));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("null") {
+    DeserializationError err = deserializeJson(doc, inPlace(nullptr));
+
+    REQUIRE(err == DeserializationError::EmptyInput);
+  }
+}
+
 TEST_CASE("deserializeJson(unsigned char*, unsigned int)") {  // issue #1897
   JsonDocument doc;
 
@@ -151,6 +226,58 @@ TEST_CASE("deserializeJson(std::istream&)") {
 
     REQUIRE('1' == char(json.get()));
   }
+
+  SECTION("Should not read after the closing brace of a long document") {
+    std::string json = "{";
+    for (int i = 0; i < 100; i++)
+      json += "\"key" + std::to_string(i) + "\":" + std::to_string(i) + ",";
+    json += "\"end\":true}123";
+    std::istringstream input(json);
+
+    DeserializationError err = deserializeJson(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["key99"] == 99);
+    REQUIRE('1' == char(input.get()));
+  }
+
+  SECTION("Leaves the stream good when it stops before the end") {
+    std::string json = "[" + std::string(100, ' ') + "1]";
+    std::istringstream input(json);
+
+    REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+    REQUIRE(input.good());
+    REQUIRE(input.tellg() == 103);
+  }
+
+  SECTION("Sets eofbit and failbit when it reads past the end") {
+    std::istringstream input(std::string(100, ' ') + "42");
+
+    REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc == 42);
+    REQUIRE(input.eof());
+    REQUIRE(input.fail());
+  }
+
+  SECTION("Sets eofbit and failbit on incomplete input") {
+    std::istringstream input("[" + std::string(100, ' ') + "1,");
+
+    REQUIRE(deserializeJson(doc, input) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(input.eof());
+    REQUIRE(input.fail());
+  }
+
+  SECTION("Should read consecutive documents") {
+    std::istringstream json("{\"a\":1} [2,3] \"four\"");
+
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc["a"] == 1);
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc[1] == 3);
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc == "four");
+  }
 }
 
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
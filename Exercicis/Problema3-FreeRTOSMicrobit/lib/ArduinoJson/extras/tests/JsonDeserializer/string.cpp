@@ -83,6 +83,44 @@ TEST_CASE("Truncated JSON string") {
   }
 }
 
+TEST_CASE("Long strings in RAM") {
+  JsonDocument doc;
+
+  SECTION("escape sequences at every position within a word") {
+    for (size_t i = 0; i < 20; i++) {
+      std::string expected(40, 'a');
+      expected.insert(i, "\n\"");
+      std::string input = "[\"" + std::string(40, 'a') + "\",  \"" +
+                          std::string(40, 'a') + "\"]";
+      input.insert(i + 47, "\\n\\\"");
+      CAPTURE(input);
+
+      REQUIRE(deserializeJson(doc, input.c_str()) == DeserializationError::Ok);
+      REQUIRE(doc[0] == std::string(40, 'a'));
+      REQUIRE(doc[1] == expected);
+
+      REQUIRE(deserializeJson(doc, input.c_str(), input.size()) ==
+              DeserializationError::Ok);
+      REQUIRE(doc[1] == expected);
+
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      REQUIRE(doc[1] == expected);
+    }
+  }
+
+  SECTION("size stops before the closing quote") {
+    std::string input = "\"" + std::string(40, 'a') + "\"";
+    REQUIRE(deserializeJson(doc, input.c_str(), input.size() - 1) ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("size stops in the middle of the spaces") {
+    std::string input = "          [1]";
+    REQUIRE(deserializeJson(doc, input.c_str(), 5) ==
+            DeserializationError::EmptyInput);
+  }
+}
+
 TEST_CASE("Escape single quote in single quoted string") {
   JsonDocument doc;
 
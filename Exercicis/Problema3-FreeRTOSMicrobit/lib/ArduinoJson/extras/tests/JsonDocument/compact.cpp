@@ -0,0 +1,69 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+TEST_CASE("JsonDocument::compact()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("null") {
+    REQUIRE(doc.compact() == true);
+
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("releases the pools emptied by remove()") {
+    for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY + 10; i++)
+      doc.add(i);
+    for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY; i++)
+      doc.remove(0);
+    spy.clearLog();
+
+    REQUIRE(doc.compact() == true);
+
+    REQUIRE(doc.size() == 10);
+    REQUIRE(doc[0] == ARDUINOJSON_POOL_CAPACITY);
+    REQUIRE(doc[9] == ARDUINOJSON_POOL_CAPACITY + 9);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Deallocate(sizeofPool()),
+                             Deallocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofPool(10)),
+                         });
+  }
+
+  SECTION("keeps the values and the order") {
+    deserializeJson(doc, "{\"a\":[1,{\"b\":2}],\"c\":\"d\",\"e\":1.5}");
+    doc["a"][1]["f"] = 3;
+    doc.remove("c");
+    doc["g"] = 1234567890123;
+
+    REQUIRE(doc.compact() == true);
+
+    REQUIRE(doc.as<std::string>() ==
+            "{\"a\":[1,{\"b\":2,\"f\":3}],\"e\":1.5,\"g\":1234567890123}");
+    REQUIRE(doc.isFrozen() == false);
+
+    doc["h"] = true;  // the document can still grow
+    REQUIRE(doc["h"] == true);
+  }
+
+  SECTION("allocation failure") {
+    TimebombAllocator timebomb(100);
+    JsonDocument doc2(&timebomb);
+    deserializeJson(doc2, "[1,2,3]");
+    timebomb.setCountdown(0);
+
+    REQUIRE(doc2.compact() == false);
+
+    REQUIRE(doc2.as<std::string>() == "[1,2,3]");
+  }
+}
@@ -0,0 +1,122 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+TEST_CASE("JsonDocument::freeze()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("null") {
+    REQUIRE(doc.freeze() == true);
+
+    REQUIRE(doc.isFrozen() == true);
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("keeps the values") {
+    const char* json =
+        "{\"a\":[1,2,{\"b\":\"c\"}],\"d\":{\"e\":[]},\"f\":1.5,"
+        "\"g\":-123456789012}";
+    deserializeJson(doc, json);
+    // insert values in the middle of the tree, so the slots aren't in order
+    doc["a"].add(3);
+    doc["d"]["h"] = 4;
+
+    REQUIRE(doc.freeze() == true);
+
+    REQUIRE(doc.as<std::string>() ==
+            "{\"a\":[1,2,{\"b\":\"c\"},3],\"d\":{\"e\":[],\"h\":4},\"f\":1.5,"
+            "\"g\":-123456789012}");
+    REQUIRE(doc["a"][3] == 3);
+    REQUIRE(doc["a"][2]["b"] == "c");
+    REQUIRE(doc["d"]["h"] == 4);
+  }
+
+  SECTION("const lookups") {
+    deserializeJson(doc, "{\"a\":[10,20,30],\"b\":{\"c\":true},\"d\":{}}");
+    doc.freeze();
+    const JsonDocument& cdoc = doc;
+
+    JsonArrayConst array = cdoc["a"];
+    REQUIRE(array.size() == 3);
+    REQUIRE(array[0] == 10);
+    REQUIRE(array[2] == 30);
+    REQUIRE(array[3].isNull());
+    REQUIRE(cdoc["b"]["c"] == true);
+    REQUIRE(cdoc["b"]["x"].isNull());
+    REQUIRE(cdoc["d"].size() == 0);
+    REQUIRE(cdoc.size() == 3);
+    REQUIRE(doc.isFrozen() == true);
+  }
+
+  SECTION("releases the free slots") {
+    deserializeJson(doc, "[1,2,3,4]");
+    doc.remove(0);
+    doc.remove(0);
+    spy.clearLog();
+
+    doc.freeze();
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Deallocate(sizeofPool(4)),
+                             Reallocate(sizeofPool(), sizeofPool(2)),
+                         });
+  }
+
+  SECTION("a change unfreezes the document") {
+    deserializeJson(doc, "[1,2]");
+    doc.freeze();
+
+    doc.add(3);
+
+    REQUIRE(doc.isFrozen() == false);
+    REQUIRE(doc.size() == 3);
+    REQUIRE(doc[2] == 3);
+  }
+
+  SECTION("clear() unfreezes the document") {
+    deserializeJson(doc, "[1,2]");
+    doc.freeze();
+
+    doc.clear();
+
+    REQUIRE(doc.isFrozen() == false);
+  }
+
+  SECTION("changing a value in place doesn't unfreeze the document") {
+    deserializeJson(doc, "[1,2]");
+    doc.freeze();
+
+    doc[0] = "hello"_s;
+
+    REQUIRE(doc.isFrozen() == true);
+    REQUIRE(doc.as<std::string>() == "[\"hello\",2]");
+  }
+}
+
+TEST_CASE("JsonDocument::freeze() allocation failure") {
+  TimebombAllocator timebomb(100);
+  SpyingAllocator spy(&timebomb);
+  JsonDocument doc(&spy);
+  deserializeJson(doc, "{\"a\":[1,2]}");
+  spy.clearLog();
+  timebomb.setCountdown(0);
+
+  REQUIRE(doc.freeze() == false);
+
+  REQUIRE(doc.isFrozen() == false);
+  REQUIRE(doc.as<std::string>() == "{\"a\":[1,2]}");
+  REQUIRE(spy.log() == AllocatorLog{
+                           AllocateFail(sizeofPool()),
+                       });
+}
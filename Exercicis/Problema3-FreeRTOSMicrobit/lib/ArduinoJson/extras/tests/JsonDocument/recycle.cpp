@@ -0,0 +1,56 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+TEST_CASE("JsonDocument::recycle()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("null") {
+    doc.recycle();
+
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("keeps the pools but releases the strings") {
+    doc["hello"_s] = "world"_s;
+    spy.clearLog();
+
+    doc.recycle();
+
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofString("hello")),
+                             Deallocate(sizeofString("world")),
+                         });
+  }
+
+  SECTION("steady state without heap calls") {
+    const char* json = "{\"a\":[1,2,3],\"b\":{\"c\":true}}";
+    char input[32];
+    deserializeJson(doc, json);
+    spy.clearLog();
+
+    doc.recycle();
+    for (int i = 0; i < 3; i++) {
+      strcpy(input, json);
+      REQUIRE(deserializeJson(doc, inPlace(input)) == DeserializationError::Ok);
+    }
+
+    REQUIRE(doc["b"]["c"] == true);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofString("a")),
+                             Deallocate(sizeofString("b")),
+                             Deallocate(sizeofString("c")),
+                         });
+  }
+}
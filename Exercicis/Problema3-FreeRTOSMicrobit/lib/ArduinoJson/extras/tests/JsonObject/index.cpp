@@ -0,0 +1,190 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::SlotId;
+
+// The size of the table for the specified number of members
+static size_t sizeofIndex(size_t members) {
+  size_t capacity = 32;
+  while (capacity < 2 * members)
+    capacity *= 2;
+  return capacity * sizeof(SlotId);
+}
+
+static std::string key(int i) {
+  return "key" + std::to_string(i);
+}
+
+static void requireMembers(JsonObjectConst obj, int count, int step = 1) {
+  for (int i = 0; i < count; i++) {
+    if (i % step == 0)
+      REQUIRE(obj[key(i)] == i);
+    else
+      REQUIRE(obj[key(i)].isNull());
+  }
+}
+
+TEST_CASE("JsonObject with many members") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+  JsonObject obj = doc.to<JsonObject>();
+  const int count = 200;
+
+  for (int i = 0; i < count; i++)
+    obj[key(i)] = i;
+
+  // the writes built the index, so buildIndex() doesn't allocate
+  spy.clearLog();
+  REQUIRE(obj.buildIndex() == true);
+  REQUIRE(spy.log() == AllocatorLog{});
+
+  SECTION("Finds every member") {
+    requireMembers(obj, count);
+    REQUIRE(obj.size() == count);
+  }
+
+  SECTION("Finds added members") {
+    for (int i = count; i < 2 * count; i++)
+      obj[key(i)] = i;
+    requireMembers(obj, 2 * count);
+    REQUIRE(obj.size() == 2 * count);
+  }
+
+  SECTION("Doesn't find removed members") {
+    for (int i = 0; i < count; i++) {
+      if (i % 3)
+        obj.remove(key(i));
+    }
+    requireMembers(obj, count, 3);
+  }
+
+  SECTION("Doesn't find members removed with an iterator") {
+    obj.remove(obj.begin());
+    REQUIRE(obj[key(0)].isNull());
+    for (int i = 1; i < count; i++)
+      REQUIRE(obj[key(i)] == i);
+  }
+
+  SECTION("Still works after shrinkToFit()") {
+    doc.shrinkToFit();
+    requireMembers(obj, count);
+    requireMembers(obj, count);
+  }
+
+  SECTION("buildIndex() after shrinkToFit()") {
+    doc.shrinkToFit();  // drops the index
+    spy.clearLog();
+
+    REQUIRE(obj.buildIndex() == true);
+    requireMembers(obj, count);
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofIndex(count)),
+                         });
+  }
+
+  SECTION("Const lookups don't build the index") {
+    doc.shrinkToFit();  // drops the index
+    spy.clearLog();
+
+    requireMembers(obj, count);
+    requireMembers(obj, count);
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("Still works after the object is replaced") {
+    doc.to<JsonObject>();
+    obj = doc.as<JsonObject>();
+    for (int i = 0; i < count; i += 2)
+      obj[key(i)] = i;
+    requireMembers(obj, count, 2);
+  }
+
+  SECTION("Still works after the document is moved") {
+    JsonDocument doc2(std::move(doc));
+    requireMembers(doc2.as<JsonObject>(), count);
+    requireMembers(doc2.as<JsonObject>(), count);
+  }
+
+  SECTION("Releases the index in clear()") {
+    doc.clear();
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+}
+
+TEST_CASE("JsonObject with many members, when the index can't be allocated") {
+  KillswitchAllocator killswitch;
+  JsonDocument doc(&killswitch);
+  JsonObject obj = doc.to<JsonObject>();
+  const int count = 100;
+
+  for (int i = 0; i < count; i++)
+    obj[key(i)] = i;
+
+  killswitch.on();
+
+  requireMembers(obj, count);
+  REQUIRE(doc.overflowed() == false);
+}
+
+TEST_CASE("deserializeJson() with many members") {
+  std::string json = "{";
+  for (int i = 0; i < 100; i++)
+    json += "\"" + key(i) + "\":" + std::to_string(i) + ",";
+  json += "\"" + key(0) + "\":-1}";  // duplicate key
+
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+  REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+
+  REQUIRE(doc.size() == 100);
+  REQUIRE(doc[key(0)] == -1);
+  for (int i = 1; i < 100; i++)
+    REQUIRE(doc[key(i)] == i);
+
+  SECTION("The root is indexed") {
+    spy.clearLog();
+    REQUIRE(doc.as<JsonObject>().buildIndex() == true);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("Const lookups don't allocate") {
+    spy.clearLog();
+    const JsonDocument& constDoc = doc;
+    for (int i = 1; i < 100; i++)
+      REQUIRE(constDoc[key(i)] == i);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
+
+TEST_CASE("deserializeJson() with many members in a nested object") {
+  std::string json = "{\"config\":{";
+  for (int i = 0; i < 100; i++)
+    json += "\"" + key(i) + "\":" + std::to_string(i) + ",";
+  json += "\"end\":0}}";
+
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+  REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+  JsonObject config = doc["config"];
+
+  spy.clearLog();
+  REQUIRE(config.buildIndex() == true);
+  REQUIRE(spy.log() == AllocatorLog{
+                           Allocate(sizeofIndex(101)),
+                       });
+
+  for (int i = 0; i < 100; i++)
+    REQUIRE(config[key(i)] == i);
+  REQUIRE(spy.log() == AllocatorLog{
+                           Allocate(sizeofIndex(101)),
+                       });
+}
@@ -0,0 +1,121 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+struct FakeIovec {
+  void* iov_base;
+  size_t iov_len;
+};
+
+static std::string concat(const ChunkedBuffer& buffer) {
+  std::string s;
+  for (auto chunk = buffer.firstChunk(); chunk; chunk = chunk->next())
+    s.append(chunk->data(), chunk->size());
+  return s;
+}
+
+TEST_CASE("ChunkedBuffer") {
+  SpyingAllocator spy;
+  ChunkedBuffer buffer(8, &spy);
+  size_t chunkBytes = sizeof(ChunkedBuffer::Chunk) + 8;
+
+  SECTION("empty") {
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.firstChunk() == nullptr);
+    REQUIRE(buffer.chunkCount() == 0);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("serializeJson()") {
+    JsonDocument doc;
+    doc["hello"] = "world";
+
+    size_t n = serializeJson(doc, buffer);
+
+    REQUIRE(n == 17);
+    REQUIRE(buffer.size() == 17);
+    REQUIRE(buffer.chunkCount() == 3);
+    REQUIRE(concat(buffer) == "{\"hello\":\"world\"}");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(chunkBytes),
+                             Allocate(chunkBytes),
+                             Allocate(chunkBytes),
+                         });
+  }
+
+  SECTION("serializeMsgPack()") {
+    JsonDocument doc;
+    doc["hello"] = "world";
+
+    size_t n = serializeMsgPack(doc, buffer);
+
+    REQUIRE(n == 13);
+    REQUIRE(concat(buffer) == "\x81\xA5hello\xA5world");
+  }
+
+  SECTION("toIovec()") {
+    buffer.write(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    FakeIovec iov[4];
+
+    size_t n = buffer.toIovec(iov, 4);
+
+    REQUIRE(n == 2);
+    REQUIRE(std::string(static_cast<char*>(iov[0].iov_base), iov[0].iov_len) ==
+            "01234567");
+    REQUIRE(std::string(static_cast<char*>(iov[1].iov_base), iov[1].iov_len) ==
+            "89");
+  }
+
+  SECTION("toIovec() with too few entries") {
+    buffer.write(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    FakeIovec iov[1];
+
+    REQUIRE(buffer.toIovec(iov, 1) == 1);
+  }
+
+  SECTION("clear() keeps the chunks") {
+    buffer.write(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    spy.clearLog();
+
+    buffer.clear();
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.firstChunk() == nullptr);
+
+    buffer.write(reinterpret_cast<const uint8_t*>("abcdefghi"), 9);
+    REQUIRE(concat(buffer) == "abcdefghi");
+    REQUIRE(buffer.chunkCount() == 2);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("allocation failure") {
+    TimebombAllocator timebomb(1);
+    ChunkedBuffer small(8, &timebomb);
+
+    size_t n = small.write(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+
+    REQUIRE(n == 8);
+    REQUIRE(small.overflowed() == true);
+    REQUIRE(small.write('x') == 0);
+  }
+
+  SECTION("destructor") {
+    {
+      ChunkedBuffer other(8, &spy);
+      other.write(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(chunkBytes),
+                             Allocate(chunkBytes),
+                             Deallocate(chunkBytes),
+                             Deallocate(chunkBytes),
+                         });
+  }
+}
@@ -89,7 +89,7 @@ TEST_CASE("serializeJson(JsonVariant)") {
 
   SECTION("Float") {
     REQUIRE(sizeof(float) == 4);
-    check(3.1415927f, "3.141593");
+    check(3.1415927f, "3.1415927");
   }
 
   SECTION("Zero") {
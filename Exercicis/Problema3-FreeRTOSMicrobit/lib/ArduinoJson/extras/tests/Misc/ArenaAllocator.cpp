@@ -0,0 +1,116 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>
+
+TEST_CASE("ArenaAllocator") {
+  alignas(void*) char buffer[64] = {};
+  ArenaAllocator arena(buffer, sizeof(buffer));
+  const size_t header = sizeof(void*);  // the size of each block
+
+  SECTION("allocate()") {
+    void* a = arena.allocate(5);
+    void* b = arena.allocate(8);
+
+    REQUIRE(a == buffer + header);
+    REQUIRE(b == buffer + 2 * header + sizeof(void*));  // aligned
+    REQUIRE(arena.size() == 2 * header + sizeof(void*) + 8);
+    REQUIRE(arena.capacity() == 64);
+  }
+
+  SECTION("allocate() fails when the buffer is full") {
+    REQUIRE(arena.allocate(64 - header) != nullptr);
+    REQUIRE(arena.allocate(0) == nullptr);
+    arena.rewind();
+    REQUIRE(arena.allocate(65 - header) == nullptr);
+  }
+
+  SECTION("deallocate() gives back the last block") {
+    arena.allocate(8);
+    void* p = arena.allocate(8);
+    arena.deallocate(p);
+
+    REQUIRE(arena.size() == header + 8);
+    REQUIRE(arena.allocate(8) == p);
+  }
+
+  SECTION("deallocate() ignores the other blocks") {
+    void* p = arena.allocate(8);
+    arena.allocate(8);
+    arena.deallocate(p);
+
+    REQUIRE(arena.size() == 2 * (header + 8));
+  }
+
+  SECTION("reallocate() grows the last block in place") {
+    arena.allocate(8);
+    void* p = arena.allocate(8);
+
+    REQUIRE(arena.reallocate(p, 32) == p);
+    REQUIRE(arena.size() == 2 * header + 8 + 32);
+    REQUIRE(arena.reallocate(p, 64) == nullptr);
+  }
+
+  SECTION("reallocate() moves the other blocks") {
+    char* p = static_cast<char*>(arena.allocate(8));
+    memcpy(p, "abcdefg", 8);
+    arena.allocate(8);
+
+    char* q = static_cast<char*>(arena.reallocate(p, 16));
+
+    REQUIRE(q == buffer + 3 * header + 16);
+    REQUIRE(strcmp(q, "abcdefg") == 0);
+  }
+
+  SECTION("reallocate() copies the old block only") {
+    char* p = static_cast<char*>(arena.allocate(4));
+    memcpy(p, "abc", 4);
+    char* next = static_cast<char*>(arena.allocate(4));
+    memcpy(next, "xyz", 4);
+
+    char* q = static_cast<char*>(arena.reallocate(p, 12));
+
+    REQUIRE(q != nullptr);
+    REQUIRE(strcmp(q, "abc") == 0);
+    for (size_t i = 4; i < 12; i++)
+      REQUIRE(q[i] == 0);  // nothing from the next block
+  }
+
+  SECTION("reallocate(nullptr) allocates") {
+    REQUIRE(arena.reallocate(nullptr, 8) == buffer + header);
+  }
+
+  SECTION("rewind()") {
+    arena.allocate(32);
+    arena.rewind();
+
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.allocate(64 - header) == buffer + header);
+  }
+
+  SECTION("as the allocator of a JsonDocument") {
+    static char docBuffer[16384];
+    ArenaAllocator docArena(docBuffer, sizeof(docBuffer));
+    JsonDocument doc(&docArena);
+
+    for (int i = 0; i < 10; i++) {
+      doc.clear();
+      docArena.rewind();
+
+      REQUIRE(deserializeJson(doc, "{\"hello\":\"world\"}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["hello"] == "world");
+    }
+  }
+
+  SECTION("as the allocator of a JsonDocument that overflows") {
+    ArenaAllocator smallArena(buffer, 16);
+    JsonDocument doc(&smallArena);
+
+    REQUIRE(deserializeJson(doc, "[1,2,3]") == DeserializationError::NoMemory);
+  }
+}
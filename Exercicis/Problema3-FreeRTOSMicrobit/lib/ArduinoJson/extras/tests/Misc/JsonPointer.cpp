@@ -0,0 +1,119 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+
+TEST_CASE("JsonPointer") {
+  JsonDocument doc;
+  deserializeJson(doc,
+                  "{\"status\":{\"motors\":[{\"pwm\":10},{\"pwm\":20}]},"
+                  "\"a/b\":1,\"m~n\":2,\"\":3,\"7\":4,\"list\":[5,6]}");
+
+  SECTION("RFC 6901 syntax") {
+    REQUIRE(JsonPointer("").resolve(doc) == doc.as<JsonVariant>());
+    REQUIRE(JsonPointer("/status/motors/1/pwm").resolve(doc) == 20);
+    REQUIRE(JsonPointer("/a~1b").resolve(doc) == 1);
+    REQUIRE(JsonPointer("/m~0n").resolve(doc) == 2);
+    REQUIRE(JsonPointer("/").resolve(doc) == 3);
+    REQUIRE(JsonPointer("/7").resolve(doc) == 4);
+    REQUIRE(JsonPointer("/list/0").resolve(doc) == 5);
+  }
+
+  SECTION("returns null when nothing matches") {
+    REQUIRE(JsonPointer("/status/servos").resolve(doc).isNull());
+    REQUIRE(JsonPointer("/status/motors/2/pwm").resolve(doc).isNull());
+    REQUIRE(JsonPointer("/list/-").resolve(doc).isNull());
+    REQUIRE(JsonPointer("/list/01").resolve(doc).isNull());
+    REQUIRE(JsonPointer("/list/1/x").resolve(doc).isNull());
+    REQUIRE(JsonPointer("/x").resolve(JsonVariantConst()).isNull());
+  }
+
+  SECTION("malformed pointers") {
+    JsonPointer noSlash("status");
+    REQUIRE(noSlash.isValid() == false);
+    REQUIRE(noSlash.resolve(doc).isNull());
+
+    REQUIRE(JsonPointer("/a~2b").isValid() == false);
+    REQUIRE(JsonPointer("/a~").isValid() == false);
+    REQUIRE(JsonPointer(static_cast<const char*>(0)).isValid() == false);
+  }
+
+  SECTION("size()") {
+    REQUIRE(JsonPointer("").size() == 0);
+    REQUIRE(JsonPointer("/").size() == 1);
+    REQUIRE(JsonPointer("/status/motors/1/pwm").size() == 4);
+    REQUIRE(JsonPointer("x").size() == 0);
+  }
+
+  SECTION("returns a writable JsonVariant") {
+    JsonPointer pointer("/status/motors/0/pwm");
+
+    pointer.resolve(doc).set(42);
+
+    REQUIRE(doc["status"]["motors"][0]["pwm"] == 42);
+  }
+
+  SECTION("works with a const document") {
+    const JsonDocument& cdoc = doc;
+
+    REQUIRE(JsonPointer("/list/1").resolve(cdoc) == 6);
+  }
+}
+
+TEST_CASE("JsonPointer reuses its hints") {
+  JsonDocument doc;
+  JsonPointer pointer("/b/y");
+
+  SECTION("refreshed document") {
+    deserializeJson(doc, "{\"a\":0,\"b\":{\"x\":1,\"y\":2}}");
+    REQUIRE(pointer.resolve(doc) == 2);
+    deserializeJson(doc, "{\"a\":0,\"b\":{\"x\":3,\"y\":4}}");
+    REQUIRE(pointer.resolve(doc) == 4);
+  }
+
+  SECTION("layout changes") {
+    deserializeJson(doc, "{\"a\":0,\"b\":{\"x\":1,\"y\":2}}");
+    REQUIRE(pointer.resolve(doc) == 2);
+    deserializeJson(doc, "{\"b\":{\"y\":5}}");
+    REQUIRE(pointer.resolve(doc) == 5);
+    deserializeJson(doc, "{\"b\":{\"z\":6,\"x\":7}}");
+    REQUIRE(pointer.resolve(doc).isNull());
+    deserializeJson(doc, "{\"c\":0,\"a\":0,\"b\":{\"x\":1,\"z\":0,\"y\":8}}");
+    REQUIRE(pointer.resolve(doc) == 8);
+  }
+
+  SECTION("frozen document") {
+    deserializeJson(doc, "{\"a\":0,\"b\":{\"x\":1}}");
+    doc["b"]["y"] = 9;  // appended out of order
+    doc.freeze();
+
+    REQUIRE(pointer.resolve(doc) == 9);
+    REQUIRE(pointer.resolve(doc) == 9);
+
+    deserializeJson(doc, "{\"b\":{\"y\":10,\"x\":1}}");
+    doc.freeze();
+
+    REQUIRE(pointer.resolve(doc) == 10);
+  }
+}
+
+TEST_CASE("JsonPointer allocates its steps once") {
+  SpyingAllocator spy;
+
+  {
+    JsonPointer pointer("/status/motors/1/pwm", &spy);
+    JsonPointer empty("", &spy);
+    REQUIRE(pointer.isValid());
+    REQUIRE(empty.isValid());
+  }
+
+  size_t size = 4 * sizeof(ArduinoJson::detail::PointerStep) + 20;
+  REQUIRE(spy.log() == AllocatorLog{
+                           Allocate(size),
+                           Deallocate(size),
+                       });
+}
@@ -0,0 +1,110 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+// Records the calls to write() and accepts up to a given number of bytes
+class SpyingPrint : public Print {
+ public:
+  explicit SpyingPrint(size_t capacity = 1000) : capacity_(capacity) {}
+
+  size_t write(uint8_t c) override {
+    calls++;
+    if (output.size() >= capacity_)
+      return 0;
+    output += static_cast<char>(c);
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) override {
+    calls++;
+    size_t room = capacity_ - output.size();
+    if (n > room)
+      n = room;
+    output.append(reinterpret_cast<const char*>(s), n);
+    return n;
+  }
+
+  std::string output;
+  int calls = 0;
+
+ private:
+  size_t capacity_;
+};
+
+TEST_CASE("serializeJson(JsonDocument, Print&)") {
+  JsonDocument doc;
+
+  SECTION("small document is written at once") {
+    doc["hello"] = "world";
+    SpyingPrint print;
+
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(n == 17);
+    REQUIRE(print.output == "{\"hello\":\"world\"}");
+    REQUIRE(print.calls == 1);
+  }
+
+  SECTION("large document is written in blocks") {
+    for (int i = 0; i < 50; i++)
+      doc.add(i);
+    std::string expected;
+    serializeJson(doc, expected);
+    SpyingPrint print;
+
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(n == expected.size());
+    REQUIRE(print.output == expected);
+    size_t blocks = (expected.size() + ARDUINOJSON_WRITER_BUFFER_SIZE - 1) /
+                    ARDUINOJSON_WRITER_BUFFER_SIZE;
+    REQUIRE(print.calls == int(blocks));
+  }
+
+  SECTION("long string is written directly") {
+    std::string value(200, 'x');
+    doc.set(value);
+    SpyingPrint print;
+
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(n == 202);
+    REQUIRE(print.output == "\"" + value + "\"");
+  }
+
+  SECTION("returns the number of bytes accepted by the destination") {
+    doc["hello"] = "world";
+    SpyingPrint print(10);
+
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(n == 10);
+    REQUIRE(print.output == "{\"hello\":\"");
+  }
+
+  SECTION("serializeMsgPack()") {
+    doc["hello"] = "world";
+    SpyingPrint print;
+
+    size_t n = serializeMsgPack(doc, print);
+
+    REQUIRE(n == 13);
+    REQUIRE(print.calls == 1);
+  }
+
+  SECTION("serializeJsonPretty()") {
+    doc["hello"] = "world";
+    SpyingPrint print;
+
+    serializeJsonPretty(doc, print);
+
+    REQUIRE(print.output == "{\r\n  \"hello\": \"world\"\r\n}");
+    REQUIRE(print.calls == 1);
+  }
+}
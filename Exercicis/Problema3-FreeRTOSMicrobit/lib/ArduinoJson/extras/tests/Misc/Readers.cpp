@@ -51,6 +51,55 @@ TEST_CASE("Reader<std::istringstream>") {
   }
 }
 
+TEST_CASE("BufferedReader<Reader<std::istringstream>>") {
+  std::istringstream src("ABCDEF");
+  using StreamReader = Reader<std::istringstream>;
+
+  REQUIRE(IsBufferable<StreamReader>::value == true);
+  REQUIRE(IsBufferable<Reader<const char*>>::value == false);
+
+  SECTION("read()") {
+    BufferedReader<StreamReader> reader(StreamReader{src});
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(reader.read() == 'B');
+  }
+
+  SECTION("readBytes()") {
+    BufferedReader<StreamReader> reader(StreamReader{src});
+    REQUIRE(reader.read() == 'A');
+
+    char buffer[8] = "abcdefg";
+    REQUIRE(reader.readBytes(buffer, 3) == 3);
+    REQUIRE(reader.readBytes(buffer + 3, 4) == 2);
+
+    REQUIRE(buffer[0] == 'B');
+    REQUIRE(buffer[1] == 'C');
+    REQUIRE(buffer[2] == 'D');
+    REQUIRE(buffer[3] == 'E');
+    REQUIRE(buffer[4] == 'F');
+    REQUIRE(buffer[5] == 'f');
+  }
+
+  SECTION("gives back unread characters") {
+    {
+      BufferedReader<StreamReader> reader(StreamReader{src});
+      REQUIRE(reader.read() == 'A');
+      REQUIRE(reader.read() == 'B');
+    }
+    REQUIRE(src.get() == 'C');
+  }
+
+  SECTION("reaches the end of the stream") {
+    {
+      BufferedReader<StreamReader> reader(StreamReader{src});
+      for (int i = 0; i < 6; i++)
+        REQUIRE(reader.read() == 'A' + i);
+      REQUIRE(reader.read() == -1);
+    }
+    REQUIRE(src.get() == -1);
+  }
+}
+
 TEST_CASE("BoundedReader<const char*>") {
   SECTION("read") {
     BoundedReader<const char*> reader("\x01\xFF", 2);
@@ -0,0 +1,149 @@
+#define ARDUINOJSON_ENABLE_ARRAY_INDEX 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <string>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::SlotId;
+
+// The size of the table for the specified number of elements
+static size_t sizeofIndex(size_t elements) {
+  size_t capacity = 16;
+  while (capacity < elements)
+    capacity *= 2;
+  return capacity * sizeof(SlotId);
+}
+
+// buildIndex() doesn't allocate when the array is already indexed
+static void requireIndexed(JsonArray array, SpyingAllocator& spy) {
+  spy.clearLog();
+  REQUIRE(array.buildIndex() == true);
+  REQUIRE(spy.log() == AllocatorLog{});
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_ARRAY_INDEX == 1") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+  JsonArray array = doc.to<JsonArray>();
+  const int count = 1000;
+
+  for (int i = 0; i < count; i++)
+    array.add(i);
+
+  SECTION("reads don't build the index") {
+    spy.clearLog();
+    for (int i = 0; i < count; i++)
+      REQUIRE(array[i] == i);
+    for (int i = 0; i < count; i++)
+      REQUIRE(array[i] == i);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("buildIndex() on a small array") {
+    JsonArray small = doc.add<JsonArray>();
+    small.add(1);
+    spy.clearLog();
+
+    REQUIRE(small.buildIndex() == true);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("buildIndex()") {
+    spy.clearLog();
+    REQUIRE(array.buildIndex() == true);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofIndex(count)),
+                         });
+
+    SECTION("operator[]") {
+      for (int i = 0; i < count; i++)
+        REQUIRE(array[i] == i);
+      REQUIRE(array[count].isNull());
+    }
+
+    SECTION("operator[] const") {
+      JsonArrayConst constArray = array;
+      for (int i = count - 1; i >= 0; i--)
+        REQUIRE(constArray[i] == i);
+    }
+
+    SECTION("add()") {
+      array.add(count);
+      REQUIRE(array[count] == count);
+      REQUIRE(array.size() == count + 1);
+      requireIndexed(array, spy);
+    }
+
+    SECTION("operator[] beyond the end") {
+      array[count + 2] = 42;
+      REQUIRE(array[count].isNull());
+      REQUIRE(array[count + 1].isNull());
+      REQUIRE(array[count + 2] == 42);
+      REQUIRE(array.size() == count + 3);
+      requireIndexed(array, spy);
+    }
+
+    SECTION("remove()") {
+      for (int i = count - 2; i >= 0; i -= 2)
+        array.remove(static_cast<size_t>(i));
+      REQUIRE(array.size() == count / 2);
+      for (int i = 0; i < count / 2; i++)
+        REQUIRE(array[i] == 2 * i + 1);
+      requireIndexed(array, spy);
+    }
+
+    SECTION("remove(iterator)") {
+      array.remove(array.begin());
+      for (int i = 0; i < count - 1; i++)
+        REQUIRE(array[i] == i + 1);
+      requireIndexed(array, spy);
+    }
+
+    SECTION("shrinkToFit()") {
+      doc.shrinkToFit();  // drops the index
+      for (int i = 0; i < count; i++)
+        REQUIRE(array[i] == i);
+
+      spy.clearLog();
+      REQUIRE(array.buildIndex() == true);
+      REQUIRE(spy.log() == AllocatorLog{
+                               Allocate(sizeofIndex(count)),
+                           });
+    }
+
+    SECTION("replace the array") {
+      array = doc.to<JsonArray>();
+      for (int i = 0; i < 100; i++)
+        array.add(-i);
+      REQUIRE(array.buildIndex() == true);
+      for (int i = 0; i < 100; i++)
+        REQUIRE(array[i] == -i);
+      REQUIRE(array[100].isNull());
+    }
+  }
+
+  SECTION("copyArray()") {
+    int values[count];
+    REQUIRE(copyArray(array, values) == count);
+    for (int i = 0; i < count; i++)
+      REQUIRE(values[i] == i);
+  }
+
+  SECTION("deserializeJson() indexes the root") {
+    std::string json = "[0";
+    for (int i = 1; i < count; i++)
+      json += "," + std::to_string(i);
+    json += "]";
+
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    array = doc.as<JsonArray>();
+    requireIndexed(array, spy);
+
+    const JsonDocument& constDoc = doc;
+    for (int i = 0; i < count; i++)
+      REQUIRE(constDoc[size_t(i)] == i);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
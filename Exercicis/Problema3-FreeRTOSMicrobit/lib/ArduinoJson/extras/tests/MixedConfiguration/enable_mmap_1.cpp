@@ -0,0 +1,89 @@
+#if defined(__unix__) || defined(__APPLE__)
+#  define ARDUINOJSON_ENABLE_MMAP 1
+#endif
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <fstream>
+#include <string>
+
+#include <stdio.h>  // remove
+
+#if ARDUINOJSON_ENABLE_MMAP
+TEST_CASE("ARDUINOJSON_ENABLE_MMAP == 1") {
+  JsonDocument doc;
+
+  SECTION("deserializeJson()") {
+    const char* path = "enable_mmap_1.json";
+    std::ofstream(path) << "{\"hello\":\"world\"}";
+
+    SECTION("copies the strings") {
+      MappedFile file(path);
+      REQUIRE(file.isOpen() == true);
+
+      DeserializationError err = deserializeJson(doc, file);
+
+      REQUIRE(err == DeserializationError::Ok);
+      REQUIRE(doc["hello"] == "world");
+      REQUIRE(doc["hello"].as<JsonString>().isStatic() == false);
+    }
+
+    SECTION("inPlace() stores pointers to the mapping") {
+      MappedFile file(path);
+
+      DeserializationError err = deserializeJson(doc, file.inPlace());
+
+      REQUIRE(err == DeserializationError::Ok);
+      REQUIRE(doc["hello"] == "world");
+      REQUIRE(doc["hello"].as<const char*>() == file.data() + 6);
+    }
+
+    SECTION("inPlace() doesn't change the file") {
+      {
+        MappedFile file(path);
+        deserializeJson(doc, file.inPlace());
+      }
+      doc.clear();
+
+      MappedFile file(path);
+      REQUIRE(std::string(file.data(), file.size()) ==
+              "{\"hello\":\"world\"}");
+    }
+
+    SECTION("empty file") {
+      std::ofstream(path).close();
+      MappedFile file(path);
+      REQUIRE(file.isOpen() == true);
+
+      DeserializationError err = deserializeJson(doc, file);
+
+      REQUIRE(err == DeserializationError::EmptyInput);
+    }
+
+    SECTION("missing file") {
+      MappedFile file("missing.json");
+      REQUIRE(file.isOpen() == false);
+
+      DeserializationError err = deserializeJson(doc, file);
+
+      REQUIRE(err == DeserializationError::EmptyInput);
+    }
+
+    remove(path);
+  }
+
+  SECTION("deserializeMsgPack()") {
+    const char* path = "enable_mmap_1.msgpack";
+    std::ofstream(path, std::ios::binary)
+        << std::string("\x92\x00\xA5hello", 8);
+
+    MappedFile file(path);
+    DeserializationError err = deserializeMsgPack(doc, file);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[0,\"hello\"]");
+
+    remove(path);
+  }
+}
+#endif
@@ -0,0 +1,32 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_SHORTEST_FLOAT 0
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_ENABLE_SHORTEST_FLOAT == 0") {
+  JsonDocument doc;
+
+  SECTION("double is limited to 9 decimal places") {
+    doc.set(3.14159265359);
+    REQUIRE(doc.as<std::string>() == "3.141592654");
+  }
+
+  SECTION("float is limited to 6 decimal places") {
+    doc.set(3.14159265359f);
+    REQUIRE(doc.as<std::string>() == "3.141593");
+  }
+
+  SECTION("rounds the last decimal") {
+    doc.set(0.9999999996);
+    REQUIRE(doc.as<std::string>() == "1");
+  }
+
+  SECTION("uses the exponentiation thresholds") {
+    doc.set(10000000.0);
+    REQUIRE(doc.as<std::string>() == "1e7");
+  }
+}
@@ -0,0 +1,91 @@
+#define ARDUINOJSON_ENABLE_STATS 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+TEST_CASE("ARDUINOJSON_ENABLE_STATS == 1") {
+  TimebombAllocator timebomb(100);
+  SpyingAllocator spy(&timebomb);
+  JsonDocument doc(&spy);
+
+  SECTION("empty document") {
+    ResourceStats stats = doc.stats();
+
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(stats.slots == 0);
+    REQUIRE(stats.pools == 0);
+    REQUIRE(stats.overflows == 0);
+    REQUIRE(stats.lastOverflow == OverflowReason::None);
+  }
+
+  SECTION("counts the calls to the allocator") {
+    doc["hello"] = "world"_s;
+    doc.shrinkToFit();
+    doc.remove("hello");
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Allocate(sizeofString("world")),
+                             Reallocate(sizeofPool(), sizeofPool(2)),
+                             Deallocate(sizeofString("world")),
+                         });
+    ResourceStats stats = doc.stats();
+    REQUIRE(stats.allocations == 2);
+    REQUIRE(stats.reallocations == 1);
+    REQUIRE(stats.deallocations == 1);
+    REQUIRE(stats.failedAllocations == 0);
+
+    doc.resetStats();
+
+    REQUIRE(doc.stats().allocations == 0);
+  }
+
+  SECTION("slots") {
+    deserializeJson(doc, "[1,2,3,4]");
+    doc.remove(0);
+    doc.remove(0);
+
+    ResourceStats stats = doc.stats();
+    REQUIRE(stats.slots == 2);
+    REQUIRE(stats.peakSlots == 4);
+    REQUIRE(stats.pools == 1);
+    REQUIRE(stats.freeSlots == 2);
+
+    doc.clear();
+
+    stats = doc.stats();
+    REQUIRE(stats.slots == 0);
+    REQUIRE(stats.peakSlots == 4);
+    REQUIRE(stats.pools == 0);
+    REQUIRE(stats.deallocations > 0);
+  }
+
+  SECTION("string pool") {
+    deserializeJson(doc, "[\"hello\",\"world\",\"hello\"]");
+
+    ResourceStats stats = doc.stats();
+    REQUIRE(stats.stringBytes == sizeofString("hello") + sizeofString("world"));
+    REQUIRE(stats.stringLookups == 3);
+    REQUIRE(stats.stringHits == 1);
+    REQUIRE(stats.stringHitRatio() == Approx(1.0 / 3));
+  }
+
+  SECTION("overflow") {
+    timebomb.setCountdown(1);
+    doc.add(1);
+    doc.add("hello"_s);
+
+    ResourceStats stats = doc.stats();
+    REQUIRE(doc.overflowed() == true);
+    REQUIRE(stats.overflows == 1);
+    REQUIRE(stats.lastOverflow == OverflowReason::String);
+    REQUIRE(stats.failedAllocations == 1);
+  }
+
+  SECTION("allocator() returns the allocator passed to the constructor") {
+    REQUIRE(doc.allocator() == &spy);
+  }
+}
@@ -0,0 +1,148 @@
+#define ARDUINOJSON_ENABLE_STD_THREAD 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+struct Record {
+  size_t index;
+  std::string json;
+  DeserializationError error;
+};
+
+struct RecordCollector {
+  std::vector<Record>* records;
+
+  void operator()(size_t index, JsonDocument& doc, DeserializationError err) {
+    records->push_back({index, doc.as<std::string>(), err});
+  }
+};
+
+static std::string generateLines(int n) {
+  std::string lines;
+  for (int i = 0; i < n; i++)
+    lines += "{\"id\":" + std::to_string(i) + ",\"tags\":[\"a\",\"b\"]}\n";
+  return lines;
+}
+
+TEST_CASE("JsonLinesParser") {
+  std::vector<Record> records;
+  RecordCollector collect{&records};
+
+  SECTION("buffer, one thread") {
+    JsonLinesParser parser(1);
+    std::string input = "{\"a\":1}\n\n[2]\r\n\"x\"";
+
+    REQUIRE(parser.parse(input.data(), input.size(), collect) == 3);
+
+    REQUIRE(records.size() == 3);
+    REQUIRE(records[0].index == 0);
+    REQUIRE(records[0].json == "{\"a\":1}");
+    REQUIRE(records[1].index == 1);
+    REQUIRE(records[1].json == "[2]");
+    REQUIRE(records[2].index == 2);
+    REQUIRE(records[2].json == "x");
+  }
+
+  SECTION("empty buffer") {
+    JsonLinesParser parser(2);
+
+    REQUIRE(parser.parse("", 0, collect) == 0);
+    REQUIRE(records.empty());
+  }
+
+  SECTION("errors are reported per line") {
+    JsonLinesParser parser(2);
+    std::string input = "[1]\n{\"a\":\n[3]\n";
+
+    REQUIRE(parser.parse(input.data(), input.size(), collect) == 3);
+
+    REQUIRE(records.size() == 3);
+    REQUIRE(records[0].error == DeserializationError::Ok);
+    REQUIRE(records[1].error == DeserializationError::IncompleteInput);
+    REQUIRE(records[2].error == DeserializationError::Ok);
+    REQUIRE(records[2].json == "[3]");
+  }
+
+  SECTION("buffer, four threads, ordered") {
+    JsonLinesParser parser(4);
+    std::string input = generateLines(500);
+
+    REQUIRE(parser.parse(input.data(), input.size(), collect) == 500);
+
+    REQUIRE(records.size() == 500);
+    for (size_t i = 0; i < records.size(); i++) {
+      REQUIRE(records[i].index == i);
+      REQUIRE(records[i].json ==
+              "{\"id\":" + std::to_string(i) + ",\"tags\":[\"a\",\"b\"]}");
+    }
+  }
+
+  SECTION("stream, four threads, unordered") {
+    JsonLinesParser parser(4);
+    std::istringstream input(generateLines(500));
+
+    REQUIRE(parser.parse(input, collect, false) == 500);
+
+    std::set<size_t> indexes;
+    for (auto& record : records) {
+      REQUIRE(record.json == "{\"id\":" + std::to_string(record.index) +
+                                 ",\"tags\":[\"a\",\"b\"]}");
+      indexes.insert(record.index);
+    }
+    REQUIRE(indexes.size() == 500);
+  }
+
+  SECTION("stream, three threads, ordered") {
+    JsonLinesParser parser(3);
+    std::istringstream input(generateLines(100));
+
+    REQUIRE(parser.parse(input, collect) == 100);
+
+    for (size_t i = 0; i < records.size(); i++)
+      REQUIRE(records[i].index == i);
+  }
+
+  SECTION("stream lines are parsed in place") {
+    SpyingAllocator spy;
+    JsonLinesParser parser(1, &spy);
+    std::istringstream input("[\"hello world\"]\n");
+
+    REQUIRE(parser.parse(input, collect) == 1);
+
+    REQUIRE(records[0].json == "[\"hello world\"]");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Deallocate(sizeofPool()),
+                         });
+  }
+
+  SECTION("buffer lines are copied") {
+    SpyingAllocator spy;
+    JsonLinesParser parser(1, &spy);
+    std::string input = "[\"hello world\"]\n";
+
+    REQUIRE(parser.parse(input.data(), input.size(), collect) == 1);
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Allocate(sizeofStringBuffer()),
+                             Reallocate(sizeofStringBuffer(),
+                                        sizeofString("hello world")),
+                             Deallocate(sizeofString("hello world")),
+                             Deallocate(sizeofPool()),
+                         });
+  }
+
+  SECTION("default thread count") {
+    JsonLinesParser parser;
+
+    REQUIRE(parser.threadCount() >= 1);
+  }
+}
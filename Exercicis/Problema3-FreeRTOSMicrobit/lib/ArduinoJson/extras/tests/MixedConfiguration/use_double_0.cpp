@@ -30,6 +30,16 @@ TEST_CASE("ARDUINOJSON_USE_DOUBLE == 0") {
     REQUIRE(json == "{\"pi\":3.14,\"e\":2.72}");
   }
 
+  SECTION("deserializeCbor() converts doubles to floats") {
+    JsonDocument doc;
+    const char input[] = "\xFB\x3F\xF8\x00\x00\x00\x00\x00\x00";  // 1.5
+
+    DeserializationError err = deserializeCbor(doc, input, sizeof(input) - 1);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<float>() == 1.5f);
+  }
+
   SECTION("parseNumber()") {
     using ArduinoJson::detail::NumberType;
     using ArduinoJson::detail::parseNumber;
@@ -0,0 +1,82 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+#include "EventLogger.hpp"
+
+TEST_CASE("parseMsgPack()") {
+  EventLogger logger;
+
+  SECTION("values") {
+    const char input[] =
+        "\x98\xC0\xC3\xC2\x2A\xD0\xD6\xCA\x40\x60\x00\x00"
+        "\xCB\x40\x0C\x00\x00\x00\x00\x00\x00\xA2hi";  // 8 elements
+
+    DeserializationError err = parseMsgPack(input, sizeof(input) - 1, logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() ==
+            "[null true false int(42)int(-42)float(3.5)float(3.5)str(hi)]");
+  }
+
+  SECTION("objects") {
+    DeserializationError err =
+        parseMsgPack("\x82\xA1" "a\x91\x01\xA1" "b\x80", logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "{key(a)[int(1)]key(b){}}");
+  }
+
+  SECTION("unsigned integers") {
+    DeserializationError err =
+        parseMsgPack("\xCF\x12\x34\x56\x78\x9A\xBC\xDE\xF0", 9, logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "uint(1311768467463790320)");
+  }
+
+  SECTION("binary") {
+    DeserializationError err = parseMsgPack("\xC4\x03" "abc", 5, logger);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "raw(5)");
+  }
+
+  SECTION("incomplete input") {
+    DeserializationError err = parseMsgPack("\x92\x01", 2, logger);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(logger.str() == "[int(1)");
+  }
+
+  SECTION("allocator") {
+    SpyingAllocator spy;
+
+    DeserializationError err =
+        parseMsgPack("\x91\xA5hello", 7, logger, &spy);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(logger.str() == "[str(hello)]");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofString("hello")),
+                             Deallocate(sizeofString("hello")),
+                         });
+  }
+
+  SECTION("empty input") {
+    REQUIRE(parseMsgPack("", 0, logger) == DeserializationError::EmptyInput);
+  }
+
+  SECTION("nesting limit") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(parseMsgPack("\x91\x01", 2, logger, nesting) ==
+            DeserializationError::Ok);
+    REQUIRE(parseMsgPack("\x91\x91\x01", 3, logger, nesting) ==
+            DeserializationError::TooDeep);
+  }
+}
@@ -5,9 +5,11 @@
 #include <ArduinoJson.h>
 #include <catch.hpp>
 
+#include "Allocators.hpp"
 #include "CustomReader.hpp"
 #include "Literals.hpp"
 
+using ArduinoJson::detail::sizeofArray;
 using ArduinoJson::detail::sizeofObject;
 
 TEST_CASE("deserializeMsgPack(const std::string&)") {
@@ -71,6 +73,139 @@ TEST_CASE("deserializeMsgPack(std::istream&)") {
   }
 }
 
+TEST_CASE("deserializeMsgPack(inPlace(char*, size_t))") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("stores pointers to the strings") {
+    char input[] = "\x81\xA5hello\xA5world";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"hello\":\"world\"}");
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() == input + 1);
+    REQUIRE(doc["hello"].as<const char*>() == input + 7);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofObject(1)),
+                         });
+  }
+
+  SECTION("stores pointers to the binaries and extensions") {
+    char input[] =
+        "\x93\xC4\x03\x01\x02\x03\xD4\x05\x2A\xC7\x01\x06\x2B";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::Ok);
+    auto binary = doc[0].as<MsgPackBinary>();
+    REQUIRE(binary.data() == input + 3);
+    REQUIRE(binary.size() == 3);
+    auto fixext = doc[1].as<MsgPackExtension>();
+    REQUIRE(fixext.type() == 5);
+    REQUIRE(fixext.data() == input + 8);
+    REQUIRE(fixext.size() == 1);
+    auto ext = doc[2].as<MsgPackExtension>();
+    REQUIRE(ext.type() == 6);
+    REQUIRE(ext.data() == input + 12);
+    REQUIRE(ext.size() == 1);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofArray(3)),
+                         });
+
+    char output[sizeof(input)];
+    REQUIRE(serializeMsgPack(doc, output, sizeof(output)) ==
+            sizeof(input) - 1);
+    REQUIRE(memcmp(output, input, sizeof(input) - 1) == 0);
+  }
+
+  SECTION("copies strings containing NUL") {
+    char input[] = "\x92\xA3" "a\x00" "b\xA1" "c";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0].as<std::string>() == "a\0b"_s);
+    REQUIRE(doc[0].as<JsonString>().isStatic() == false);
+    REQUIRE(doc[1].as<JsonString>().isStatic() == true);
+  }
+
+  SECTION("copying the document duplicates the binaries") {
+    char input[] = "\x91\xC4\x01\x2A";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+    JsonDocument copy(doc);
+    memset(input, 0, sizeof(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    auto binary = copy[0].as<MsgPackBinary>();
+    REQUIRE(binary.size() == 1);
+    REQUIRE(*static_cast<const char*>(binary.data()) == 0x2A);
+  }
+
+  SECTION("incomplete string") {
+    char input[] = "\x91\xA5hel";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("incomplete binary") {
+    char input[] = "\x91\xC4\x03\x01";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("truncated str32") {
+    char input[] = "\x91\xDB\x00\x00\x01\x00" "abc";
+
+    DeserializationError err =
+        deserializeMsgPack(doc, inPlace(input, sizeof(input) - 1));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeMsgPack(inPlace(char*))") {
+  JsonDocument doc;
+
+  SECTION("strings need the size of the input") {
+    char input[] = "\x91\xDB\xFF\xFF\xFF\xFF" "abc";
+
+    DeserializationError err = deserializeMsgPack(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("binaries need the size of the input") {
+    char input[] = "\x91\xC6\xFF\xFF\xFF\xFF" "abc";
+
+    DeserializationError err = deserializeMsgPack(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("numbers") {
+    char input[] = "\x92\x01\x02";
+
+    DeserializationError err = deserializeMsgPack(doc, inPlace(input));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[1,2]");
+  }
+}
+
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
 TEST_CASE("deserializeMsgPack(VLA)") {
   size_t i = 16;
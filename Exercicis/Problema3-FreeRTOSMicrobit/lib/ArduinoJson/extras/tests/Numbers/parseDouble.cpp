@@ -82,6 +82,34 @@ TEST_CASE("parseNumber<double>()") {
     checkDouble("-1797693.134862315711111111111111", -1797693.1348623157);
   }
 
+  SECTION("CorrectlyRounded") {
+    // Approx() isn't enough: we want the closest double
+    REQUIRE(parseNumber<double>("0.30000000000000004") ==
+            0.30000000000000004);
+    REQUIRE(parseNumber<double>("8.533e+68") == 8.533e+68);
+    REQUIRE(parseNumber<double>("4.1006e-184") == 4.1006e-184);
+    REQUIRE(parseNumber<double>("9.998e+307") == 9.998e+307);
+    REQUIRE(parseNumber<double>("2.2250738585072011e-308") ==
+            2.2250738585072011e-308);
+    REQUIRE(parseNumber<double>("4.9406564584124654e-324") ==
+            4.9406564584124654e-324);
+    REQUIRE(parseNumber<double>("1234567890.123456789") ==
+            1234567890.123456789);
+  }
+
+  SECTION("Halfway") {
+    // exactly halfway between 1 and the next double: round to even
+    REQUIRE(parseNumber<double>(
+                "1.00000000000000011102230246251565404236316680908203125") ==
+            1.0);
+    // the last digit breaks the tie, even though it doesn't fit in 64 bits
+    REQUIRE(parseNumber<double>(
+                "1.000000000000000111022302462515654042363166809082031251") ==
+            1.0000000000000002);
+    REQUIRE(parseNumber<double>("9007199254740993.0000000001") ==
+            9007199254740994.0);
+  }
+
   SECTION("ExponentTooBig") {
     checkDoubleInf("1e309", false);
     checkDoubleInf("-1e309", true);
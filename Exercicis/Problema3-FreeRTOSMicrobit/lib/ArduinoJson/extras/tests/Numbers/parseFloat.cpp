@@ -71,6 +71,12 @@ TEST_CASE("parseNumber<float>()") {
     //     1e+32f);
   }
 
+  SECTION("CorrectlyRounded") {
+    REQUIRE(parseNumber<float>("6.09") == 6.09f);
+    REQUIRE(parseNumber<float>("7.038531e-26") == 7.038531e-26f);
+    REQUIRE(parseNumber<float>("1.17549435e-38") == 1.17549435e-38f);
+  }
+
   SECTION("NaN") {
     checkFloatNaN("NaN");
     checkFloatNaN("nan");
@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/ResourceManagerImpl.hpp>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson::detail;
+
+TEST_CASE("ResourceManager::recycle()") {
+  SpyingAllocator spy;
+  ResourceManager resources(&spy);
+
+  SECTION("keeps the pools") {
+    for (size_t i = 0; i < 2 * ARDUINOJSON_POOL_CAPACITY; i++)
+      resources.allocVariant();
+    spy.clearLog();
+
+    resources.recycle();
+
+    REQUIRE(resources.size() == 0);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("reuses the pools") {
+    for (size_t i = 0; i < 2 * ARDUINOJSON_POOL_CAPACITY; i++)
+      resources.allocVariant();
+    resources.recycle();
+    spy.clearLog();
+
+    for (size_t i = 0; i < 2 * ARDUINOJSON_POOL_CAPACITY; i++)
+      REQUIRE(resources.allocVariant().id() == i);
+
+    REQUIRE(spy.log() == AllocatorLog{});
+    REQUIRE(resources.size() == sizeofPool() * 2);
+  }
+
+  SECTION("resets the free list") {
+    auto a = resources.allocVariant();
+    resources.allocVariant();
+    resources.freeVariant(a);
+
+    resources.recycle();
+
+    REQUIRE(resources.allocVariant().id() == 0);
+    REQUIRE(resources.allocVariant().id() == 1);
+  }
+
+  SECTION("releases the strings") {
+    resources.saveString(adaptString("hello"));
+    spy.clearLog();
+
+    resources.recycle();
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofString("hello")),
+                         });
+  }
+
+  SECTION("shrinkToFit() releases the recycled pools") {
+    for (size_t i = 0; i < 2 * ARDUINOJSON_POOL_CAPACITY; i++)
+      resources.allocVariant();
+    resources.recycle();
+    resources.allocVariant();
+    spy.clearLog();
+
+    resources.shrinkToFit();
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofPool(1)),
+                         });
+  }
+
+  SECTION("clear() releases the recycled pools") {
+    resources.allocVariant();
+    resources.recycle();
+    spy.clearLog();
+
+    resources.clear();
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofPool()),
+                         });
+  }
+}
@@ -0,0 +1,103 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson::detail;
+
+static StringNode* saveString(ResourceManager& resources, std::string s) {
+  return resources.saveString(adaptString(s.c_str(), s.size()));
+}
+
+static std::string key(int i) {
+  return "key" + std::to_string(i);
+}
+
+TEST_CASE("StringPool with many strings") {
+  SpyingAllocator spy;
+  ResourceManager resources(&spy);
+  const int count = 100;
+
+  StringNode* nodes[count];
+  for (int i = 0; i < count; i++)
+    nodes[i] = saveString(resources, key(i));
+
+  SECTION("Deduplicates identical strings") {
+    for (int i = 0; i < count; i++) {
+      auto node = saveString(resources, key(i));
+      REQUIRE(node == nodes[i]);
+      REQUIRE(node->references == 2);
+    }
+  }
+
+  SECTION("getString() finds every string") {
+    for (int i = 0; i < count; i++)
+      REQUIRE(resources.getString(adaptString(key(i))) == nodes[i]);
+    REQUIRE(resources.getString(adaptString("missing")) == nullptr);
+  }
+
+  SECTION("dereferenceString() releases the string") {
+    size_t sizeBefore = resources.size();
+
+    for (int i = 0; i < count; i += 2)
+      resources.dereferenceString(nodes[i]->data);
+
+    for (int i = 0; i < count; i++) {
+      auto node = resources.getString(adaptString(key(i)));
+      if (i % 2)
+        REQUIRE(node == nodes[i]);
+      else
+        REQUIRE(node == nullptr);
+    }
+    REQUIRE(resources.size() < sizeBefore);
+  }
+
+  SECTION("dereferenceString() keeps referenced strings") {
+    saveString(resources, key(42));
+    resources.dereferenceString(nodes[42]->data);
+    REQUIRE(resources.getString(adaptString(key(42))) == nodes[42]);
+    REQUIRE(nodes[42]->references == 1);
+  }
+
+  SECTION("clear() releases everything") {
+    resources.clear();
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+}
+
+TEST_CASE("StringPool when the index can't grow") {
+  TimebombAllocator timebomb(100);
+  ResourceManager resources(&timebomb);
+  const int count = 25;  // the index grows when adding the 25th string
+
+  StringNode* nodes[count];
+  for (int i = 0; i < count; i++) {
+    if (i == count - 1)
+      timebomb.setCountdown(1);  // enough for the string, not for the index
+    nodes[i] = saveString(resources, key(i));
+    REQUIRE(nodes[i] != nullptr);
+  }
+
+  timebomb.setCountdown(100);
+
+  SECTION("Falls back to linear search") {
+    for (int i = 0; i < count; i++)
+      REQUIRE(saveString(resources, key(i)) == nodes[i]);
+    REQUIRE(resources.overflowed() == false);
+  }
+
+  SECTION("Rebuilds the index on next insertion") {
+    auto node = saveString(resources, key(count));
+    REQUIRE(node != nullptr);
+    for (int i = 0; i < count; i++)
+      REQUIRE(saveString(resources, key(i)) == nodes[i]);
+    REQUIRE(saveString(resources, key(count)) == node);
+  }
+}
@@ -25,7 +25,7 @@ void check(TFloat input, const std::string& expected) {
 
 TEST_CASE("TextFormatter::writeFloat(double)") {
   SECTION("Pi") {
-    check<double>(3.14159265359, "3.141592654");
+    check<double>(3.14159265359, "3.14159265359");
   }
 
   SECTION("Signaling NaN") {
@@ -50,17 +50,21 @@ TEST_CASE("TextFormatter::writeFloat(double)") {
   }
 
   SECTION("Espilon") {
-    check<double>(2.2250738585072014E-308, "2.225073859e-308");
-    check<double>(-2.2250738585072014E-308, "-2.225073859e-308");
+    check<double>(2.2250738585072014E-308, "2.2250738585072014e-308");
+    check<double>(-2.2250738585072014E-308, "-2.2250738585072014e-308");
   }
 
   SECTION("Max double") {
-    check<double>(1.7976931348623157E+308, "1.797693135e308");
-    check<double>(-1.7976931348623157E+308, "-1.797693135e308");
+    check<double>(1.7976931348623157E+308, "1.7976931348623157e308");
+    check<double>(-1.7976931348623157E+308, "-1.7976931348623157e308");
+  }
+
+  SECTION("Denormalized") {
+    check<double>(4.9406564584124654E-324, "5e-324");
+    check<double>(2.2250738585072009E-308, "2.225073858507201e-308");
   }
 
   SECTION("Big exponent") {
-    // this test increases coverage of normalize()
     check<double>(1e255, "1e255");
     check<double>(1e-255, "1e-255");
   }
@@ -81,32 +85,32 @@ TEST_CASE("TextFormatter::writeFloat(double)") {
     check<double>(-10000000.0, "-1e7");
   }
 
-  SECTION("Rounding when too many decimals") {
-    check<double>(0.000099999999999, "0.0001");
-    check<double>(0.0000099999999999, "1e-5");
-    check<double>(0.9999999996, "1");
+  SECTION("Shortest representation") {
+    check<double>(0.1, "0.1");
+    check<double>(0.3, "0.3");
+    check<double>(0.1 + 0.2, "0.30000000000000004");
+    check<double>(1e22, "1e22");
+    check<double>(123456789012.0, "1.23456789012e11");
+    check<double>(5e-6, "5e-6");
   }
 
-  SECTION("9 decimal places") {
-    check<double>(0.100000001, "0.100000001");
-    check<double>(0.999999999, "0.999999999");
-
-    check<double>(9.000000001, "9.000000001");
-    check<double>(9.999999999, "9.999999999");
+  SECTION("All the digits that are needed") {
+    check<double>(0.000099999999999, "0.000099999999999");
+    check<double>(0.0000099999999999, "9.9999999999e-6");
+    check<double>(0.9999999996, "0.9999999996");
+    check<double>(9.9999999999, "9.9999999999");
   }
 
-  SECTION("10 decimal places") {
-    check<double>(0.1000000001, "0.1");
-    check<double>(0.9999999999, "1");
-
-    check<double>(9.0000000001, "9");
-    check<double>(9.9999999999, "10");
+  SECTION("Integers") {
+    check<double>(1.0, "1");
+    check<double>(1000.0, "1000");
+    check<double>(9007199254740992.0, "9.007199254740992e15");
   }
 }
 
 TEST_CASE("TextFormatter::writeFloat(float)") {
   SECTION("Pi") {
-    check<float>(3.14159265359f, "3.141593");
+    check<float>(3.14159265359f, "3.1415927");
   }
 
   SECTION("999.9") {  // issue #543
@@ -116,4 +120,11 @@ TEST_CASE("TextFormatter::writeFloat(float)") {
   SECTION("24.3") {  // # issue #588
     check<float>(24.3f, "24.3");
   }
+
+  SECTION("Shortest representation") {
+    check<float>(0.1f, "0.1");
+    check<float>(16777216.0f, "1.6777216e7");
+    check<float>(3.4028235e38f, "3.4028235e38");
+    check<float>(1.4e-45f, "1e-45");
+  }
 }
@@ -18,6 +18,14 @@ void check(const char* input, std::string expected) {
   REQUIRE(writer.bytesWritten() == expected.size());
 }
 
+void check(const std::string& input, std::string expected) {
+  char output[64] = {0};
+  StaticStringWriter sb(output, sizeof(output));
+  TextFormatter<StaticStringWriter> writer(sb);
+  writer.writeString(input.data(), input.size());
+  REQUIRE(expected == std::string(output, writer.bytesWritten()));
+}
+
 TEST_CASE("TextFormatter::writeString()") {
   SECTION("EmptyString") {
     check("", "\"\"");
@@ -54,4 +62,42 @@ TEST_CASE("TextFormatter::writeString()") {
   SECTION("HorizontalTab") {
     check("\t", "\"\\t\"");
   }
+
+  SECTION("Other control characters are not escaped") {
+    check("\x01\x1F", "\"\x01\x1F\"");
+  }
+
+  SECTION("Non-ASCII characters") {
+    check("caf\xC3\xA9 \xE2\x82\xAC", "\"caf\xC3\xA9 \xE2\x82\xAC\"");
+  }
+
+  SECTION("Long runs between escapes") {
+    check("The quick \"brown\" fox\njumps over the \\lazy\\ dog",
+          "\"The quick \\\"brown\\\" fox\\njumps over the "
+          "\\\\lazy\\\\ dog\"");
+  }
+
+  SECTION("Escape at every position of a word") {
+    for (size_t i = 0; i < 17; i++) {
+      std::string input(17, 'x');
+      input[i] = '"';
+      std::string expected = "\"" + input + "\"";
+      expected.insert(i + 1, 1, '\\');
+
+      CAPTURE(i);
+      check(input.c_str(), expected);
+      check(input, expected);
+    }
+  }
+}
+
+TEST_CASE("TextFormatter::writeString(const char*, size_t)") {
+  SECTION("Empty") {
+    check(std::string(), "\"\"");
+  }
+
+  SECTION("NUL in the middle") {
+    check(std::string("0123456789\0abcdefghij", 21),
+          "\"0123456789\\u0000abcdefghij\"");
+  }
 }
@@ -36,16 +36,25 @@
 #include "ArduinoJson/Array/ElementProxy.hpp"
 #include "ArduinoJson/Array/Utilities.hpp"
 #include "ArduinoJson/Collection/CollectionImpl.hpp"
+#include "ArduinoJson/Memory/ArenaAllocator.hpp"
 #include "ArduinoJson/Memory/ResourceManagerImpl.hpp"
 #include "ArduinoJson/Object/MemberProxy.hpp"
 #include "ArduinoJson/Object/ObjectImpl.hpp"
+#include "ArduinoJson/Serialization/ChunkedBuffer.hpp"
 #include "ArduinoJson/Variant/ConverterImpl.hpp"
+#include "ArduinoJson/Variant/JsonPointer.hpp"
 #include "ArduinoJson/Variant/JsonVariantCopier.hpp"
 #include "ArduinoJson/Variant/VariantCompare.hpp"
 #include "ArduinoJson/Variant/VariantImpl.hpp"
 #include "ArduinoJson/Variant/VariantRefBaseImpl.hpp"
 
+#include "ArduinoJson/Cbor/CborDeserializer.hpp"
+#include "ArduinoJson/Cbor/CborSerializer.hpp"
+#include "ArduinoJson/Cbor/CborTimestamp.hpp"
+#include "ArduinoJson/Deserialization/JsonFields.hpp"
 #include "ArduinoJson/Json/JsonDeserializer.hpp"
+#include "ArduinoJson/Json/JsonIncrementalParser.hpp"
+#include "ArduinoJson/Json/JsonLinesParser.hpp"
 #include "ArduinoJson/Json/JsonSerializer.hpp"
 #include "ArduinoJson/Json/PrettyJsonSerializer.hpp"
 #include "ArduinoJson/MsgPack/MsgPackBinary.hpp"
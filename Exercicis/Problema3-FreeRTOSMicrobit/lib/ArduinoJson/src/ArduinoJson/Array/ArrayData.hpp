@@ -49,10 +49,18 @@ class ArrayData : public CollectionData {
     array->removeElement(index, resources);
   }
 
-  void remove(iterator it, ResourceManager* resources) {
-    CollectionData::removeOne(it, resources);
+  // Indexes the elements, unless the array is small.
+  // Returns false if the index is disabled or couldn't be allocated.
+  bool buildIndex(ResourceManager* resources);
+
+  static bool buildIndex(ArrayData* array, ResourceManager* resources) {
+    if (!array)
+      return false;
+    return array->buildIndex(resources);
   }
 
+  void remove(iterator it, ResourceManager* resources);
+
   static void remove(ArrayData* array, iterator it,
                      ResourceManager* resources) {
     if (array)
@@ -61,6 +69,7 @@ class ArrayData : public CollectionData {
 
  private:
   iterator at(size_t index, const ResourceManager* resources) const;
+  void appendOne(Slot<VariantData> slot, ResourceManager* resources);
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
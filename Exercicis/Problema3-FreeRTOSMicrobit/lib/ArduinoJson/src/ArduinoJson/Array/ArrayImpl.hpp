@@ -12,6 +12,20 @@ ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 inline ArrayData::iterator ArrayData::at(
     size_t index, const ResourceManager* resources) const {
+  if (resources->frozen()) {  // the elements are in consecutive slots
+    if (head() == NULL_SLOT || index > size_t(tail() - head()))
+      return iterator();
+    auto id = SlotId(head() + index);
+    return iterator(resources->getVariant(id), id);
+  }
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  // only read the index, so that const lookups can run concurrently
+  auto& arrayIndex = resources->arrayIndex();
+  if (arrayIndex.covers(this)) {
+    auto id = arrayIndex.get(index);
+    return iterator(resources->getVariant(id), id);
+  }
+#endif
   auto it = createIterator(resources);
   while (!it.done() && index) {
     it.next(resources);
@@ -20,16 +34,40 @@ inline ArrayData::iterator ArrayData::at(
   return it;
 }
 
+inline void ArrayData::appendOne(Slot<VariantData> slot,
+                                 ResourceManager* resources) {
+  CollectionData::appendOne(slot, resources);
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  if (resources->arrayIndex().covers(this))
+    resources->arrayIndex().append(slot.id(), resources);
+#endif
+}
+
 inline VariantData* ArrayData::addElement(ResourceManager* resources) {
   auto slot = resources->allocVariant();
   if (!slot)
     return nullptr;
-  CollectionData::appendOne(slot, resources);
+  appendOne(slot, resources);
   return slot.ptr();
 }
 
 inline VariantData* ArrayData::getOrAddElement(size_t index,
                                                ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto& arrayIndex = resources->arrayIndex();
+  if (arrayIndex.covers(this)) {
+    if (index < arrayIndex.size())
+      return resources->getVariant(arrayIndex.get(index));
+    VariantData* element = nullptr;
+    for (size_t n = index - arrayIndex.size() + 1; n > 0; n--) {
+      element = addElement(resources);
+      if (!element)
+        return nullptr;
+    }
+    return element;
+  }
+  arrayIndex.onLinearSearch(this, index, resources);
+#endif
   auto it = createIterator(resources);
   while (!it.done() && index > 0) {
     it.next(resources);
@@ -56,6 +94,25 @@ inline void ArrayData::removeElement(size_t index, ResourceManager* resources) {
   remove(at(index, resources), resources);
 }
 
+inline bool ArrayData::buildIndex(ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  if (resources->frozen())  // the elements are in consecutive slots
+    return true;
+  return resources->arrayIndex().cover(this, resources);
+#else
+  (void)resources;  // silence warning
+  return false;
+#endif
+}
+
+inline void ArrayData::remove(iterator it, ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  if (!it.done() && resources->arrayIndex().covers(this))
+    resources->arrayIndex().remove(it.currentId_);
+#endif
+  CollectionData::removeOne(it, resources);
+}
+
 template <typename T>
 inline bool ArrayData::addValue(const T& value, ResourceManager* resources) {
   ARDUINOJSON_ASSERT(resources != nullptr);
@@ -67,9 +124,70 @@ inline bool ArrayData::addValue(const T& value, ResourceManager* resources) {
     resources->freeVariant(slot);
     return false;
   }
-  CollectionData::appendOne(slot, resources);
+  appendOne(slot, resources);
+  return true;
+}
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+inline bool ArrayIndex::cover(const CollectionData* array,
+                              const ResourceManager* resources) {
+  if (array_ == array || array->size(resources) < minElements)
+    return true;
+  array_ = build(array, resources) ? array : nullptr;
+  return array_ != nullptr;
+}
+
+inline void ArrayIndex::onLinearSearch(const CollectionData* array,
+                                       size_t steps,
+                                       const ResourceManager* resources) {
+  if (steps < minElements)
+    return;
+  if (candidate_ != array) {
+    // wait for a second access to avoid thrashing between two arrays
+    candidate_ = array;
+    return;
+  }
+  array_ = build(array, resources) ? array : nullptr;
+}
+
+inline void ArrayIndex::append(SlotId id, const ResourceManager* resources) {
+  ARDUINOJSON_ASSERT(array_ != nullptr);
+  if (count_ == capacity_ && !reserve(capacity_ * 2, resources)) {
+    array_ = nullptr;  // fall back to linear search
+    return;
+  }
+  table_[count_++] = id;
+}
+
+inline bool ArrayIndex::build(const CollectionData* array,
+                              const ResourceManager* resources) {
+  size_t capacity = minElements;
+  size_t size = array->size(resources);
+  while (capacity < size)
+    capacity *= 2;
+
+  if (capacity > capacity_ && !reserve(capacity, resources))
+    return false;
+
+  count_ = 0;
+  for (auto id = array->head(); id != NULL_SLOT;
+       id = resources->getVariant(id)->next())
+    table_[count_++] = id;
+  return true;
+}
+
+inline bool ArrayIndex::reserve(size_t capacity,
+                                const ResourceManager* resources) {
+  auto allocator = resources->allocator();
+  auto table = table_ ? allocator->reallocate(table_, capacity * sizeof(SlotId))
+                      : allocator->allocate(capacity * sizeof(SlotId));
+  if (!table)
+    return false;
+  table_ = static_cast<SlotId*>(table);
+  capacity_ = capacity;
   return true;
 }
+#endif
 
 // Returns the size (in bytes) of an array with n elements.
 constexpr size_t sizeofArray(size_t n) {
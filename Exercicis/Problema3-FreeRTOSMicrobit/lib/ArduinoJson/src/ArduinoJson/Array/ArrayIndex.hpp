@@ -0,0 +1,117 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+#include <string.h>  // memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+class CollectionData;
+class ResourceManager;
+
+// Table of the element slots of one large array: the root of the last
+// deserialized document, the last one passed to JsonArray::buildIndex(), or the
+// last one that was accessed by index twice in a row by getOrAddElement().
+// Const lookups only read it, so that several threads can read a document.
+// ArrayData keeps it in sync when elements are added or removed, and
+// ResourceManager drops it when slots might move.
+class ArrayIndex {
+ public:
+  // Below this index, following the slot chain is fast enough
+  static constexpr size_t minElements = 16;
+
+  ArrayIndex() = default;
+  ArrayIndex(const ArrayIndex&) = delete;
+  void operator=(const ArrayIndex&) = delete;
+
+  ~ArrayIndex() {
+    ARDUINOJSON_ASSERT(table_ == nullptr);
+  }
+
+  friend void swap(ArrayIndex& a, ArrayIndex& b) {
+    swap_(a.table_, b.table_);
+    swap_(a.capacity_, b.capacity_);
+    swap_(a.count_, b.count_);
+    swap_(a.array_, b.array_);
+    swap_(a.candidate_, b.candidate_);
+  }
+
+  bool covers(const CollectionData* array) const {
+    return array_ && array_ == array;
+  }
+
+  size_t size() const {
+    return count_;
+  }
+
+  // Returns the id of the element slot, or NULL_SLOT if out of range
+  SlotId get(size_t index) const {
+    ARDUINOJSON_ASSERT(array_ != nullptr);
+    return index < count_ ? table_[index] : NULL_SLOT;
+  }
+
+  // Builds the table of the specified array, unless it's small.
+  // Returns false if there wasn't enough memory.
+  bool cover(const CollectionData* array, const ResourceManager* resources);
+
+  // Called after following the specified number of links in the slot chain
+  void onLinearSearch(const CollectionData* array, size_t steps,
+                      const ResourceManager* resources);
+
+  // Called after an element was appended to the array
+  void append(SlotId id, const ResourceManager* resources);
+
+  // Called before an element is removed from the array
+  void remove(SlotId id) {
+    ARDUINOJSON_ASSERT(array_ != nullptr);
+    for (size_t i = 0; i < count_; i++) {
+      if (table_[i] == id) {
+        count_--;
+        memmove(table_ + i, table_ + i + 1, (count_ - i) * sizeof(SlotId));
+        return;
+      }
+    }
+  }
+
+  // Called when the array is destroyed
+  void invalidate(const CollectionData* array) {
+    if (array_ == array)
+      array_ = nullptr;
+    if (candidate_ == array)
+      candidate_ = nullptr;
+  }
+
+  // Called when the slots are moved or swapped
+  void reset() {
+    array_ = nullptr;
+    candidate_ = nullptr;
+  }
+
+  void clear(Allocator* allocator) {
+    reset();
+    if (table_)
+      allocator->deallocate(table_);
+    table_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+  }
+
+ private:
+  bool build(const CollectionData* array, const ResourceManager* resources);
+  bool reserve(size_t capacity, const ResourceManager* resources);
+
+  SlotId* table_ = nullptr;
+  size_t capacity_ = 0;
+  size_t count_ = 0;
+  const CollectionData* array_ = nullptr;
+  const CollectionData* candidate_ = nullptr;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -130,6 +130,16 @@ class JsonArray : public detail::VariantOperators<JsonArray> {
     detail::ArrayData::clear(data_, resources_);
   }
 
+  // Indexes the elements, so that reading a large array by index doesn't
+  // follow the links from the first element. The document keeps one array
+  // index: building it for this array drops the previous one.
+  // deserializeJson() indexes the root.
+  // Returns false if ARDUINOJSON_ENABLE_ARRAY_INDEX is 0 or if there wasn't
+  // enough memory.
+  bool buildIndex() const {
+    return detail::ArrayData::buildIndex(data_, resources_);
+  }
+
   // Gets or sets the element at the specified index.
   // https://arduinojson.org/v7/api/jsonarray/subscript/
   template <typename T,
@@ -0,0 +1,489 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Cbor/halfFloat.hpp>
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuffer.hpp>
+#include <ArduinoJson/MsgPack/endianness.hpp>
+#include <ArduinoJson/MsgPack/ieee754.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Parses CBOR (RFC 8949) into a VariantData.
+// Byte strings are stored as raw strings, header included, so serializeCbor()
+// writes them back. Tags are dropped, except tag 1 on an integer, which is
+// kept the same way, see CborTimestamp.
+// Keys must be text strings; indefinite-length strings are not supported.
+template <typename TReader>
+class CborDeserializer {
+ public:
+  CborDeserializer(ResourceManager* resources, TReader reader)
+      : resources_(resources), reader_(reader), stringBuffer_(resources) {}
+
+  template <typename TFilter>
+  DeserializationError parse(VariantData& variant, TFilter filter,
+                             DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+    uint8_t code;
+
+    err = readByte(code);
+    if (err)
+      return DeserializationError::EmptyInput;
+
+    return parseVariant(code, &variant, filter, nestingLimit);
+  }
+
+ private:
+  // The first byte of a data item: the major type and the additional info
+  template <typename TFilter>
+  DeserializationError::Code parseVariant(
+      uint8_t code, VariantData* variant, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    bool allowValue = filter.allowValue();
+
+    if (allowValue) {
+      // callers pass a null pointer only when value must be ignored
+      ARDUINOJSON_ASSERT(variant != 0);
+    }
+
+    uint8_t header[10];  // room for a timestamp: the tag and the integer
+    uint8_t headerSize;
+    uint64_t argument;
+    bool indefinite;
+
+    for (;;) {
+      header[0] = code;
+
+      if (code >> 5 == 7)
+        return readSimpleValue(variant, code, allowValue);
+
+      err = readArgument(header, headerSize, argument, indefinite);
+      if (err)
+        return err;
+
+      if (code >> 5 != 6)
+        break;
+
+      // tag: only epoch timestamps are kept
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (argument == 1 && code >> 5 <= 1 && allowValue) {
+        header[0] = 0xc1;  // tag 1, in its shortest form
+        header[1] = code;
+        err = readArgument(header + 1, headerSize, argument, indefinite);
+        if (err)
+          return err;
+        return saveRawString(variant, header, uint8_t(1 + headerSize), 0);
+      }
+    }
+
+    switch (code >> 5) {
+      case 0:  // unsigned integer
+      case 1:  // negative integer
+        if (allowValue)
+          return setInteger(variant, argument, code >> 5 == 1);
+        return DeserializationError::Ok;
+
+      case 2:  // byte string
+      case 3:  // text string
+        if (indefinite)
+          return DeserializationError::InvalidInput;  // not supported
+        if (!allowValue)
+          return skipBytes(argument);
+        if (code >> 5 == 2)
+          return saveRawString(variant, header, headerSize, argument);
+        err = readString(argument);
+        if (err)
+          return err;
+        variant->setOwnedString(stringBuffer_.save());
+        return DeserializationError::Ok;
+
+      case 4:
+        return readArray(variant, size_t(argument), indefinite, filter,
+                         nestingLimit);
+
+      default:
+        return readObject(variant, size_t(argument), indefinite, filter,
+                          nestingLimit);
+    }
+  }
+
+  // Major type 7: false, true, null, undefined, and floats
+  DeserializationError::Code readSimpleValue(VariantData* variant,
+                                             uint8_t code, bool allowValue) {
+    switch (code) {
+      case 0xf4:
+      case 0xf5:
+        if (allowValue)
+          variant->setBoolean(code == 0xf5);
+        return DeserializationError::Ok;
+
+      case 0xf9: {
+        uint16_t value;
+        auto err = readInteger(value);
+        if (err || !allowValue)
+          return err;
+        variant->setFloat(halfToFloat(value), resources_);
+        return DeserializationError::Ok;
+      }
+
+      case 0xfa:
+        if (allowValue)
+          return readFloat<float>(variant);
+        else
+          return skipBytes(4);
+
+      case 0xfb:
+        if (allowValue)
+          return readDouble<JsonFloat>(variant);
+        else
+          return skipBytes(8);
+
+      case 0xf8:  // simple value on one more byte
+        return skipBytes(1);
+
+      case 0xfc:
+      case 0xfd:
+      case 0xfe:
+      case 0xff:  // break outside of an indefinite-length item
+        return DeserializationError::InvalidInput;
+
+      default:  // null, undefined, and unassigned simple values
+        return DeserializationError::Ok;
+    }
+  }
+
+  // Reads the argument that follows the initial byte in header[0], and
+  // appends its bytes to header
+  DeserializationError::Code readArgument(uint8_t* header, uint8_t& headerSize,
+                                          uint64_t& value, bool& indefinite) {
+    uint8_t info = header[0] & 0x1f;
+    headerSize = 1;
+    indefinite = false;
+    value = 0;
+
+    if (info < 24) {
+      value = info;
+      return DeserializationError::Ok;
+    }
+
+    if (info == 31) {
+      uint8_t major = header[0] >> 5;
+      indefinite = true;
+      return major >= 2 && major <= 5 ? DeserializationError::Ok
+                                      : DeserializationError::InvalidInput;
+    }
+
+    if (info > 27)
+      return DeserializationError::InvalidInput;
+
+    uint8_t sizeBytes = uint8_t(1U << (info - 24));
+    auto err = readBytes(header + 1, sizeBytes);
+    if (err)
+      return err;
+
+    for (uint8_t i = 0; i < sizeBytes; i++)
+      value = (value << 8) | header[i + 1];
+    headerSize = uint8_t(1 + sizeBytes);
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readByte(uint8_t& value) {
+    int c = reader_.read();
+    if (c < 0)
+      return DeserializationError::IncompleteInput;
+    value = static_cast<uint8_t>(c);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readBytes(void* p, size_t n) {
+    if (reader_.readBytes(reinterpret_cast<char*>(p), n) == n)
+      return DeserializationError::Ok;
+    return DeserializationError::IncompleteInput;
+  }
+
+  template <typename T>
+  DeserializationError::Code readInteger(T& value) {
+    auto err = readBytes(&value, sizeof(value));
+    if (err)
+      return err;
+    fixEndianness(value);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code skipBytes(uint64_t n) {
+    for (; n; --n) {
+      if (reader_.read() < 0)
+        return DeserializationError::IncompleteInput;
+    }
+    return DeserializationError::Ok;
+  }
+
+  // A negative integer is -1 - value
+  DeserializationError::Code setInteger(VariantData* variant, uint64_t value,
+                                        bool isNegative) {
+    if (isNegative) {
+      if (value <= 0x7FFFFFFFFFFFFFFF) {
+        auto signedValue = -1 - static_cast<int64_t>(value);
+        auto truncatedValue = static_cast<JsonInteger>(signedValue);
+        if (truncatedValue == signedValue)
+          if (!variant->setInteger(truncatedValue, resources_))
+            return DeserializationError::NoMemory;
+      }
+      // else set null on overflow
+    } else {
+      auto truncatedValue = static_cast<JsonUInt>(value);
+      if (truncatedValue == value)
+        if (!variant->setInteger(truncatedValue, resources_))
+          return DeserializationError::NoMemory;
+      // else set null on overflow
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename T>
+  DeserializationError::Code readFloat(VariantData* variant) {
+    T value;
+    auto err = readInteger(value);
+    if (err)
+      return err;
+
+    variant->setFloat(value, resources_);
+    return DeserializationError::Ok;
+  }
+
+  template <typename T>
+  enable_if_t<sizeof(T) == 8, DeserializationError::Code> readDouble(
+      VariantData* variant) {
+    T value;
+    auto err = readInteger(value);
+    if (err)
+      return err;
+
+    if (variant->setFloat(value, resources_))
+      return DeserializationError::Ok;
+    else
+      return DeserializationError::NoMemory;
+  }
+
+  template <typename T>
+  enable_if_t<sizeof(T) == 4, DeserializationError::Code> readDouble(
+      VariantData* variant) {
+    uint8_t i[8];  // input is 8 bytes
+    T value;
+    uint8_t* o = reinterpret_cast<uint8_t*>(&value);  // output is 4 bytes
+
+    auto err = readBytes(i, 8);
+    if (err)
+      return err;
+
+    doubleToFloat(i, o);
+    fixEndianness(value);
+    variant->setFloat(value, resources_);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readString(uint64_t n) {
+    auto size = size_t(n);
+    if (size != n)                            // integer overflow
+      return DeserializationError::NoMemory;  // (not testable on 64-bit)
+
+    char* p = stringBuffer_.reserve(size);
+    if (!p)
+      return DeserializationError::NoMemory;
+
+    return readBytes(p, size);
+  }
+
+  // Stores the header and the n bytes that follow as a raw string
+  DeserializationError::Code saveRawString(VariantData* variant,
+                                           const uint8_t* header,
+                                           uint8_t headerSize, uint64_t n) {
+    auto totalSize = size_t(headerSize + n);
+    if (totalSize < n)                        // integer overflow
+      return DeserializationError::NoMemory;  // (not testable on 64-bit)
+
+    char* p = stringBuffer_.reserve(totalSize);
+    if (!p)
+      return DeserializationError::NoMemory;
+
+    memcpy(p, header, headerSize);
+
+    auto err = readBytes(p + headerSize, size_t(n));
+    if (err)
+      return err;
+
+    variant->setRawString(stringBuffer_.save());
+    return DeserializationError::Ok;
+  }
+
+  template <typename TFilter>
+  DeserializationError::Code readArray(
+      VariantData* variant, size_t n, bool indefinite, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    bool allowArray = filter.allowArray();
+
+    ArrayData* array;
+    if (allowArray) {
+      ARDUINOJSON_ASSERT(variant != 0);
+      array = &variant->toArray();
+    } else {
+      array = 0;
+    }
+
+    TFilter elementFilter = filter[0U];
+
+    for (; indefinite || n; --n) {
+      uint8_t code;
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (indefinite && code == 0xff)  // break
+        break;
+
+      VariantData* value;
+
+      if (elementFilter.allow()) {
+        ARDUINOJSON_ASSERT(array != 0);
+        value = array->addElement(resources_);
+        if (!value)
+          return DeserializationError::NoMemory;
+      } else {
+        value = 0;
+      }
+
+      err = parseVariant(code, value, elementFilter, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename TFilter>
+  DeserializationError::Code readObject(
+      VariantData* variant, size_t n, bool indefinite, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    ObjectData* object;
+    if (filter.allowObject()) {
+      ARDUINOJSON_ASSERT(variant != 0);
+      object = &variant->toObject();
+    } else {
+      object = 0;
+    }
+
+    for (; indefinite || n; --n) {
+      uint8_t code;
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (indefinite && code == 0xff)  // break
+        break;
+
+      err = readKey(code);
+      if (err)
+        return err;
+
+      JsonString key = stringBuffer_.str();
+      TFilter memberFilter = filter[key.c_str()];
+      VariantData* member;
+
+      if (memberFilter.allow()) {
+        ARDUINOJSON_ASSERT(object != 0);
+
+        // Save key in memory pool.
+        auto savedKey = stringBuffer_.save();
+
+        member = object->addMember(savedKey, resources_);
+        if (!member)
+          return DeserializationError::NoMemory;
+      } else {
+        member = 0;
+      }
+
+      err = readByte(code);
+      if (err)
+        return err;
+
+      err = parseVariant(code, member, memberFilter, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readKey(uint8_t code) {
+    if (code >> 5 != 3)  // text string
+      return DeserializationError::InvalidInput;
+
+    uint8_t header[9];
+    uint8_t headerSize;
+    uint64_t size;
+    bool indefinite;
+    header[0] = code;
+    auto err = readArgument(header, headerSize, size, indefinite);
+    if (err)
+      return err;
+    if (indefinite)
+      return DeserializationError::InvalidInput;  // not supported
+
+    return readString(size);
+  }
+
+  ResourceManager* resources_;
+  TReader reader_;
+  StringBuffer stringBuffer_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a CBOR input (RFC 8949) and puts the result in a JsonDocument.
+template <typename TDestination, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value, int> = 0>
+inline DeserializationError deserializeCbor(TDestination&& dst,
+                                            Args&&... args) {
+  using namespace detail;
+  return deserialize<CborDeserializer>(detail::forward<TDestination>(dst),
+                                       detail::forward<Args>(args)...);
+}
+
+// Parses a CBOR input (RFC 8949) and puts the result in a JsonDocument.
+template <typename TDestination, typename TChar, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value, int> = 0>
+inline DeserializationError deserializeCbor(TDestination&& dst, TChar* input,
+                                            Args&&... args) {
+  using namespace detail;
+  return deserialize<CborDeserializer>(detail::forward<TDestination>(dst),
+                                       input, detail::forward<Args>(args)...);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
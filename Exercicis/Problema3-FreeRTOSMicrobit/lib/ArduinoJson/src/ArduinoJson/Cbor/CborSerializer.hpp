@@ -0,0 +1,198 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Cbor/halfFloat.hpp>
+#include <ArduinoJson/MsgPack/endianness.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/CountingDecorator.hpp>
+#include <ArduinoJson/Serialization/measure.hpp>
+#include <ArduinoJson/Serialization/serialize.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Produces the preferred serialization of RFC 8949: definite lengths, the
+// shortest arguments, and the shortest floats that keep the exact value
+template <typename TWriter>
+class CborSerializer : public VariantDataVisitor<size_t> {
+ public:
+  static const bool producesText = false;
+
+  CborSerializer(TWriter writer, const ResourceManager* resources)
+      : writer_(writer), resources_(resources) {}
+
+  template <typename T>
+  enable_if_t<is_floating_point<T>::value && sizeof(T) == 4, size_t> visit(
+      T value32) {
+    uint16_t value16;
+    if (floatToHalf(value32, value16)) {
+      writeByte(0xF9);
+      writeInteger(value16);
+    } else {
+      writeByte(0xFA);
+      writeInteger(value32);
+    }
+    return bytesWritten();
+  }
+
+  template <typename T>
+  ARDUINOJSON_NO_SANITIZE("float-cast-overflow")
+  enable_if_t<is_floating_point<T>::value && sizeof(T) == 8, size_t> visit(
+      T value64) {
+    float value32 = float(value64);
+    if (value32 == value64 || value64 != value64)  // exact or NaN
+      return visit(value32);
+    writeByte(0xFB);
+    writeInteger(value64);
+    return bytesWritten();
+  }
+
+  size_t visit(const ArrayData& array) {
+    writeHead(4, JsonUInt(array.size(resources_)));
+
+    auto slotId = array.head();
+    while (slotId != NULL_SLOT) {
+      auto slot = resources_->getVariant(slotId);
+      slot->accept(*this, resources_);
+      slotId = slot->next();
+    }
+
+    return bytesWritten();
+  }
+
+  size_t visit(const ObjectData& object) {
+    writeHead(5, JsonUInt(object.size(resources_)));
+
+    auto slotId = object.head();
+    while (slotId != NULL_SLOT) {
+      auto slot = resources_->getVariant(slotId);
+      slot->accept(*this, resources_);
+      slotId = slot->next();
+    }
+
+    return bytesWritten();
+  }
+
+  size_t visit(const char* value) {
+    return visit(JsonString(value));
+  }
+
+  size_t visit(JsonString value) {
+    ARDUINOJSON_ASSERT(!value.isNull());
+
+    writeHead(3, JsonUInt(value.size()));
+    writeBytes(reinterpret_cast<const uint8_t*>(value.c_str()), value.size());
+    return bytesWritten();
+  }
+
+  size_t visit(RawString value) {
+    writeBytes(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+    return bytesWritten();
+  }
+
+  size_t visit(JsonInteger value) {
+    if (value >= 0)
+      writeHead(0, JsonUInt(value));
+    else
+      writeHead(1, JsonUInt(-1 - value));
+    return bytesWritten();
+  }
+
+  size_t visit(JsonUInt value) {
+    writeHead(0, value);
+    return bytesWritten();
+  }
+
+  size_t visit(bool value) {
+    writeByte(value ? 0xF5 : 0xF4);
+    return bytesWritten();
+  }
+
+  size_t visit(nullptr_t) {
+    writeByte(0xF6);
+    return bytesWritten();
+  }
+
+ private:
+  size_t bytesWritten() const {
+    return writer_.count();
+  }
+
+  // Writes the major type and its argument: a value, a length, or a count
+  void writeHead(uint8_t majorType, JsonUInt value) {
+    auto major = uint8_t(majorType << 5);
+    if (value < 24) {
+      writeByte(uint8_t(major | value));
+    } else if (value <= 0xFF) {
+      writeByte(uint8_t(major | 24));
+      writeInteger(uint8_t(value));
+    } else if (value <= 0xFFFF) {
+      writeByte(uint8_t(major | 25));
+      writeInteger(uint16_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else if (value <= 0xFFFFFFFF)
+#else
+    else
+#endif
+    {
+      writeByte(uint8_t(major | 26));
+      writeInteger(uint32_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else {
+      writeByte(uint8_t(major | 27));
+      writeInteger(uint64_t(value));
+    }
+#endif
+  }
+
+  void writeByte(uint8_t c) {
+    writer_.write(c);
+  }
+
+  void writeBytes(const uint8_t* p, size_t n) {
+    writer_.write(p, n);
+  }
+
+  template <typename T>
+  void writeInteger(T value) {
+    fixEndianness(value);
+    writeBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+  }
+
+  CountingDecorator<TWriter> writer_;
+  const ResourceManager* resources_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Produces a CBOR document (RFC 8949).
+template <
+    typename TDestination,
+    detail::enable_if_t<!detail::is_pointer<TDestination>::value, int> = 0>
+inline size_t serializeCbor(JsonVariantConst source, TDestination& output) {
+  using namespace ArduinoJson::detail;
+  return serialize<CborSerializer>(source, output);
+}
+
+// Produces a CBOR document (RFC 8949).
+inline size_t serializeCbor(JsonVariantConst source, void* output,
+                            size_t size) {
+  using namespace ArduinoJson::detail;
+  return serialize<CborSerializer>(source, output, size);
+}
+
+// Computes the length of the document that serializeCbor() produces.
+inline size_t measureCbor(JsonVariantConst source) {
+  using namespace ArduinoJson::detail;
+  return measure<CborSerializer>(source);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
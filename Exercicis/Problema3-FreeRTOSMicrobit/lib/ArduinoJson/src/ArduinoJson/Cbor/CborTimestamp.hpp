@@ -0,0 +1,110 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Variant/Converter.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// An epoch-based date/time: CBOR tag 1 on an integer number of seconds.
+// deserializeCbor() keeps this tag, and serializeCbor() writes it back.
+class CborTimestamp {
+ public:
+  CborTimestamp() : seconds_(0) {}
+  explicit CborTimestamp(JsonInteger seconds) : seconds_(seconds) {}
+
+  JsonInteger seconds() const {
+    return seconds_;
+  }
+
+ private:
+  JsonInteger seconds_;
+};
+
+template <>
+struct Converter<CborTimestamp> : private detail::VariantAttorney {
+  static void toJson(CborTimestamp src, JsonVariant dst) {
+    auto data = getData(dst);
+    if (!data)
+      return;
+    auto resources = getResourceManager(dst);
+    data->clear(resources);
+
+    uint8_t major;
+    JsonUInt value;
+    if (src.seconds() >= 0) {
+      major = 0x00;  // unsigned integer
+      value = JsonUInt(src.seconds());
+    } else {
+      major = 0x20;  // negative integer
+      value = JsonUInt(-1 - src.seconds());
+    }
+
+    uint8_t buffer[2 + sizeof(JsonUInt)];
+    size_t n = 0;
+    buffer[n++] = 0xc1;  // tag 1
+    if (value < 24) {
+      buffer[n++] = uint8_t(major | value);
+    } else {
+      uint8_t sizeBytes = 1, info = 24;
+      while (sizeBytes < sizeof(value) && value >> (sizeBytes * 8)) {
+        sizeBytes = uint8_t(sizeBytes * 2);
+        info++;
+      }
+      buffer[n++] = uint8_t(major | info);
+      for (uint8_t i = sizeBytes; i > 0; i--)
+        buffer[n++] = uint8_t(value >> ((i - 1) * 8) & 0xff);
+    }
+
+    data->setRawString(
+        serialized(reinterpret_cast<const char*>(buffer), n), resources);
+  }
+
+  static CborTimestamp fromJson(JsonVariantConst src) {
+    CborTimestamp result;
+    decode(src, result);
+    return result;
+  }
+
+  static bool checkJson(JsonVariantConst src) {
+    CborTimestamp result;
+    return decode(src, result);
+  }
+
+ private:
+  static bool decode(JsonVariantConst src, CborTimestamp& result) {
+    auto data = getData(src);
+    if (!data)
+      return false;
+    auto rawstr = data->asRawString();
+    auto p = reinterpret_cast<const uint8_t*>(rawstr.c_str());
+    if (rawstr.size() < 2 || p[0] != 0xc1 || p[1] >> 5 > 1)
+      return false;
+
+    uint8_t info = p[1] & 0x1f;
+    JsonUInt value = 0;
+    if (info < 24) {
+      if (rawstr.size() != 2)
+        return false;
+      value = info;
+    } else if (info <= 27) {
+      size_t sizeBytes = size_t(1) << (info - 24);
+      if (sizeBytes > sizeof(value) || rawstr.size() != 2 + sizeBytes)
+        return false;
+      for (size_t i = 0; i < sizeBytes; i++)
+        value = JsonUInt(value << 8 | p[2 + i]);
+    } else {
+      return false;
+    }
+
+    auto seconds = JsonInteger(value);
+    if (seconds < 0)  // doesn't fit in a JsonInteger
+      return false;
+    result = CborTimestamp(p[1] >> 5 ? -1 - seconds : seconds);
+    return true;
+  }
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,79 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/integer.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Converts a float to IEEE 754 half precision.
+// Returns false if the half can't hold the exact value.
+inline bool floatToHalf(float value, uint16_t& half) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  auto sign = uint16_t(bits >> 16 & 0x8000);
+  auto exponent = int16_t(bits >> 23 & 0xff);
+  uint32_t mantissa = bits & 0x7fffff;
+
+  if (exponent == 0xff) {  // infinity or NaN (the payload is lost)
+    half = uint16_t(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+    return true;
+  }
+
+  if (exponent == 0) {  // zero, or a float subnormal, too small for a half
+    half = sign;
+    return mantissa == 0;
+  }
+
+  exponent = int16_t(exponent - 127);
+
+  if (exponent > 15)
+    return false;
+
+  if (exponent >= -14) {  // normal
+    half = uint16_t(sign | uint32_t(exponent + 15) << 10 | mantissa >> 13);
+    return (mantissa & 0x1fff) == 0;
+  }
+
+  if (exponent >= -24) {  // subnormal
+    mantissa |= 0x800000;
+    auto shift = uint8_t(-1 - exponent);
+    half = uint16_t(sign | mantissa >> shift);
+    return (mantissa & ((uint32_t(1) << shift) - 1)) == 0;
+  }
+
+  return false;
+}
+
+// Converts an IEEE 754 half precision to a float, which is always exact
+inline float halfToFloat(uint16_t half) {
+  uint32_t sign = uint32_t(half & 0x8000) << 16;
+  uint32_t exponent = half >> 10 & 0x1f;
+  uint32_t mantissa = half & 0x3ff;
+  uint32_t bits;
+
+  if (exponent == 0x1f) {  // infinity or NaN
+    bits = sign | 0x7f800000 | mantissa << 13;
+  } else if (exponent) {  // normal
+    bits = sign | (exponent + 112) << 23 | mantissa << 13;
+  } else if (mantissa) {  // subnormal, normal as a float
+    exponent = 113;
+    while (!(mantissa & 0x400)) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | exponent << 23 | (mantissa & 0x3ff) << 13;
+  } else {  // zero
+    bits = sign;
+  }
+
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -16,10 +16,13 @@ class VariantData;
 class ResourceManager;
 
 class CollectionIterator {
+  friend class ArrayData;
   friend class CollectionData;
+  friend class ObjectData;
 
  public:
-  CollectionIterator() : slot_(nullptr), currentId_(NULL_SLOT) {}
+  CollectionIterator()
+      : slot_(nullptr), currentId_(NULL_SLOT), nextId_(NULL_SLOT) {}
 
   void next(const ResourceManager* resources);
 
@@ -96,6 +99,16 @@ class CollectionData {
     return head_;
   }
 
+  SlotId tail() const {
+    return tail_;
+  }
+
+  // Points to the children after ResourceManager::freeze() moved them
+  void moveChildren(SlotId head, SlotId tail) {
+    head_ = head;
+    tail_ = tail;
+  }
+
  protected:
   void appendOne(Slot<VariantData> slot, const ResourceManager* resources);
   void appendPair(Slot<VariantData> key, Slot<VariantData> value,
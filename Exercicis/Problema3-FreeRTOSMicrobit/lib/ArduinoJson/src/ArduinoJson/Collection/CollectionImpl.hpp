@@ -66,6 +66,13 @@ inline void CollectionData::clear(ResourceManager* resources) {
     resources->freeVariant({slot, currId});
   }
 
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  resources->objectIndex().invalidate(this);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  resources->arrayIndex().invalidate(this);
+#endif
+
   head_ = NULL_SLOT;
   tail_ = NULL_SLOT;
 }
@@ -128,6 +135,8 @@ inline size_t CollectionData::nesting(const ResourceManager* resources) const {
 }
 
 inline size_t CollectionData::size(const ResourceManager* resources) const {
+  if (resources->frozen())  // the children are in consecutive slots
+    return head_ == NULL_SLOT ? 0 : size_t(tail_ - head_) + 1;
   size_t count = 0;
   for (auto it = createIterator(resources); !it.done(); it.next(resources))
     count++;
@@ -56,6 +56,19 @@
 #  endif
 #endif
 
+// Support MappedFile, which maps a file in memory with mmap().
+// Disabled by default because it includes the POSIX headers; only available
+// on Unix and macOS.
+#ifndef ARDUINOJSON_ENABLE_MMAP
+#  define ARDUINOJSON_ENABLE_MMAP 0
+#endif
+
+// Support JsonLinesParser, which uses std::thread.
+// Disabled by default because some toolchains need -pthread to link it.
+#ifndef ARDUINOJSON_ENABLE_STD_THREAD
+#  define ARDUINOJSON_ENABLE_STD_THREAD 0
+#endif
+
 // Pointer size: a heuristic to set sensible defaults
 #ifndef ARDUINOJSON_SIZEOF_POINTER
 #  if defined(__SIZEOF_POINTER__)
@@ -135,6 +148,35 @@
 #  endif
 #endif
 
+// Index the string pool with a hash table to speed up string deduplication
+// Disabled by default on 8-bit platforms because it's not worth the increase in
+// code size
+#ifndef ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+#  if ARDUINOJSON_SIZEOF_POINTER <= 2
+#    define ARDUINOJSON_ENABLE_STRING_POOL_INDEX 0
+#  else
+#    define ARDUINOJSON_ENABLE_STRING_POOL_INDEX 1
+#  endif
+#endif
+
+// Index the keys of large objects with a hash table to speed up lookups
+// Disabled by default on 8-bit platforms because it's not worth the increase in
+// code size
+#ifndef ARDUINOJSON_ENABLE_OBJECT_INDEX
+#  if ARDUINOJSON_SIZEOF_POINTER <= 2
+#    define ARDUINOJSON_ENABLE_OBJECT_INDEX 0
+#  else
+#    define ARDUINOJSON_ENABLE_OBJECT_INDEX 1
+#  endif
+#endif
+
+// Keep a table of the element slots of large arrays for constant-time access
+// by index
+// Disabled by default because it requires an extra SlotId per element
+#ifndef ARDUINOJSON_ENABLE_ARRAY_INDEX
+#  define ARDUINOJSON_ENABLE_ARRAY_INDEX 0
+#endif
+
 // Number of bytes to store the length of a string
 // https://arduinojson.org/v7/config/string_length_size/
 #ifndef ARDUINOJSON_STRING_LENGTH_SIZE
@@ -225,6 +267,16 @@
 #  define ARDUINOJSON_ENABLE_INFINITY 0
 #endif
 
+// Serialize floats with the fewest digits that read back as the same value
+// Disabled by default on 8-bit platforms because it uses 64-bit arithmetic
+#ifndef ARDUINOJSON_ENABLE_SHORTEST_FLOAT
+#  if ARDUINOJSON_SIZEOF_POINTER <= 2
+#    define ARDUINOJSON_ENABLE_SHORTEST_FLOAT 0
+#  else
+#    define ARDUINOJSON_ENABLE_SHORTEST_FLOAT 1
+#  endif
+#endif
+
 // Control the exponentiation threshold for big numbers
 // CAUTION: cannot be more that 1e9 !!!!
 // https://arduinojson.org/v7/config/positive_exponentiation_threshold/
@@ -265,6 +317,21 @@
 #  define ARDUINOJSON_STRING_BUFFER_SIZE 32
 #endif
 
+// Size of the window used to read streams in blocks
+#ifndef ARDUINOJSON_READER_BUFFER_SIZE
+#  define ARDUINOJSON_READER_BUFFER_SIZE 64
+#endif
+
+// Size of the block used to write to Print in bulk (0 to disable)
+#ifndef ARDUINOJSON_WRITER_BUFFER_SIZE
+#  define ARDUINOJSON_WRITER_BUFFER_SIZE 64
+#endif
+
+// Count the allocations and the pool occupancy, see JsonDocument::stats()
+#ifndef ARDUINOJSON_ENABLE_STATS
+#  define ARDUINOJSON_ENABLE_STATS 0
+#endif
+
 #ifndef ARDUINOJSON_DEBUG
 #  ifdef __PLATFORMIO_BUILD_DEBUG__
 #    define ARDUINOJSON_DEBUG 1
@@ -0,0 +1,293 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArrayConst.hpp>
+#include <ArduinoJson/Deserialization/DeserializationOptions.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+#include <ArduinoJson/Polyfills/integer.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+using FilterIndex = uint16_t;
+
+// Node zero denies everything and isn't stored
+struct FilterNode {
+  static const uint8_t allow = 1;
+  static const uint8_t allowArray = 2;
+  static const uint8_t allowObject = 4;
+  static const uint8_t allowValue = 8;
+
+  FilterIndex element;   // the filter of the array elements
+  FilterIndex fallback;  // the filter of the keys that aren't in members
+  FilterIndex firstMember;
+  FilterIndex memberCount;
+  uint8_t flags;
+};
+
+// The members of an object node are sorted by hash, so that a key is found
+// with a binary search on its hash; the keys are compared only when the hashes
+// match. A sorted array needs no empty buckets, unlike a hash table.
+struct FilterMember {
+  uint32_t hash;
+  FilterIndex node;
+  FilterIndex keyOffset;
+  FilterIndex keyLength;
+};
+
+struct FilterTable {
+  FilterNode* nodes;
+  FilterMember* members;
+  char* keys;
+};
+
+// The filter that the deserializer carries down the tree: a position in the
+// table of a CompiledFilter
+class CompiledFilterRef {
+ public:
+  CompiledFilterRef(const FilterTable* table, FilterIndex node)
+      : table_(table), node_(node) {}
+
+  bool allow() const {
+    return (flags() & FilterNode::allow) != 0;
+  }
+
+  bool allowArray() const {
+    return (flags() & FilterNode::allowArray) != 0;
+  }
+
+  bool allowObject() const {
+    return (flags() & FilterNode::allowObject) != 0;
+  }
+
+  bool allowValue() const {
+    return (flags() & FilterNode::allowValue) != 0;
+  }
+
+  template <typename TIndex, enable_if_t<is_integral<TIndex>::value, int> = 0>
+  CompiledFilterRef operator[](TIndex) const {
+    if (!node_)
+      return *this;
+    return CompiledFilterRef(table_, table_->nodes[node_].element);
+  }
+
+  template <typename TKey, enable_if_t<!is_integral<TKey>::value, int> = 0>
+  CompiledFilterRef operator[](const TKey& key) const {
+    if (!node_)
+      return *this;
+    const FilterNode& node = table_->nodes[node_];
+    if (node.memberCount) {
+      auto s = adaptString(key);
+      uint32_t hash = stringHash(s);
+
+      // find the first member with this hash
+      auto members = table_->members + node.firstMember;
+      size_t lo = 0, hi = node.memberCount;
+      while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (members[mid].hash < hash)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      for (; lo < node.memberCount && members[lo].hash == hash; lo++) {
+        auto& member = members[lo];
+        auto memberKey = adaptString(table_->keys + member.keyOffset,
+                                     member.keyLength);
+        if (stringEquals(s, memberKey))
+          return CompiledFilterRef(table_, member.node);
+      }
+    }
+    return CompiledFilterRef(table_, node.fallback);
+  }
+
+ private:
+  uint8_t flags() const {
+    return node_ ? table_->nodes[node_].flags : 0;
+  }
+
+  const FilterTable* table_;
+  FilterIndex node_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+namespace DeserializationOption {
+
+// A filter converted to a compact table, which the deserializer walks without
+// touching the original JsonDocument: an array of nodes, an array of members
+// sorted by hash, and the key bytes.
+// Compile it once and pass it to as many deserializeJson() calls as needed.
+class CompiledFilter {
+ public:
+  explicit CompiledFilter(
+      JsonVariantConst filter,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : allocator_(allocator), table_{nullptr, nullptr, nullptr} {
+    Counts counts = {1, 0, 0};  // node zero isn't stored, but has an index
+    count(filter, counts);
+    if (counts.nodes > maxIndex || counts.members > maxIndex ||
+        counts.keyBytes > maxIndex)
+      return;
+
+    size_t membersSize = counts.members * sizeof(detail::FilterMember);
+    size_t nodesSize = counts.nodes * sizeof(detail::FilterNode);
+    auto block = static_cast<char*>(
+        allocator_->allocate(membersSize + nodesSize + counts.keyBytes));
+    if (!block)
+      return;
+
+    // the members come first, because they have the strictest alignment
+    table_.members = reinterpret_cast<detail::FilterMember*>(block);
+    table_.nodes = reinterpret_cast<detail::FilterNode*>(block + membersSize);
+    table_.keys = block + membersSize + nodesSize;
+
+    Counts next = {1, 0, 0};
+    root_ = build(filter, next);
+  }
+
+  CompiledFilter(const CompiledFilter&) = delete;
+  CompiledFilter& operator=(const CompiledFilter&) = delete;
+
+  ~CompiledFilter() {
+    if (table_.members)
+      allocator_->deallocate(table_.members);
+  }
+
+  // Returns true if the table couldn't be allocated.
+  // In that case, the filter rejects everything.
+  bool overflowed() const {
+    return root_ == 0;
+  }
+
+  detail::CompiledFilterRef root() const {
+    return detail::CompiledFilterRef(&table_, root_);
+  }
+
+ private:
+  static const size_t maxIndex = detail::FilterIndex(-1);
+
+  struct Counts {
+    size_t nodes;
+    size_t members;
+    size_t keyBytes;
+  };
+
+  static bool isWildcard(JsonString key) {
+    return key.size() == 1 && key.c_str()[0] == '*';
+  }
+
+  static void count(JsonVariantConst filter, Counts& counts) {
+    counts.nodes++;
+    if (Filter(filter).allowValue())  // "true" means "allow recursively"
+      return;
+    for (JsonPairConst kvp : filter.as<JsonObjectConst>()) {
+      if (!isWildcard(kvp.key())) {
+        counts.members++;
+        counts.keyBytes += kvp.key().size();
+      }
+      count(kvp.value(), counts);
+    }
+    auto array = filter.as<JsonArrayConst>();
+    if (array.size() > 0)
+      count(array[0], counts);
+  }
+
+  detail::FilterIndex build(JsonVariantConst filter, Counts& next) {
+    using namespace detail;
+
+    Filter f(filter);
+    auto id = FilterIndex(next.nodes++);
+    FilterNode node = {0, 0, 0, 0, 0};
+    node.flags = uint8_t((f.allow() ? FilterNode::allow : 0) |
+                         (f.allowArray() ? FilterNode::allowArray : 0) |
+                         (f.allowObject() ? FilterNode::allowObject : 0) |
+                         (f.allowValue() ? FilterNode::allowValue : 0));
+
+    if (f.allowValue()) {
+      node.element = id;
+      node.fallback = id;
+    } else if (filter.is<JsonObjectConst>()) {
+      auto object = filter.as<JsonObjectConst>();
+
+      JsonVariantConst wildcard = object["*"];
+      if (!wildcard.isNull())
+        node.fallback = build(wildcard, next);
+      node.element = node.fallback;  // like filter[0] on an object
+
+      // reserve the members before the recursion adds the nested ones
+      node.firstMember = FilterIndex(next.members);
+      for (JsonPairConst kvp : object)
+        if (!isWildcard(kvp.key()))
+          node.memberCount++;
+      next.members += node.memberCount;
+
+      auto member = table_.members + node.firstMember;
+      for (JsonPairConst kvp : object) {
+        if (isWildcard(kvp.key()))
+          continue;
+        JsonString key = kvp.key();
+        memcpy(table_.keys + next.keyBytes, key.c_str(), key.size());
+        member->hash = stringHash(adaptString(key));
+        member->keyOffset = FilterIndex(next.keyBytes);
+        member->keyLength = FilterIndex(key.size());
+        next.keyBytes += key.size();
+        member->node = kvp.value().isNull() ? node.fallback
+                                            : build(kvp.value(), next);
+        member++;
+      }
+      sortByHash(table_.members + node.firstMember, node.memberCount);
+    } else if (filter.is<JsonArrayConst>()) {
+      auto array = filter.as<JsonArrayConst>();
+      if (array.size() > 0)
+        node.element = build(array[0], next);
+    }
+
+    table_.nodes[id] = node;
+    return id;
+  }
+
+  static void sortByHash(detail::FilterMember* members, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+      auto member = members[i];
+      size_t j = i;
+      for (; j > 0 && members[j - 1].hash > member.hash; j--)
+        members[j] = members[j - 1];
+      members[j] = member;
+    }
+  }
+
+  Allocator* allocator_;
+  detail::FilterTable table_;
+  detail::FilterIndex root_ = 0;
+};
+
+}  // namespace DeserializationOption
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+inline DeserializationOptions<CompiledFilterRef> makeDeserializationOptions(
+    const DeserializationOption::CompiledFilter& filter,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return {filter.root(), nestingLimit};
+}
+
+inline DeserializationOptions<CompiledFilterRef> makeDeserializationOptions(
+    DeserializationOption::NestingLimit nestingLimit,
+    const DeserializationOption::CompiledFilter& filter) {
+  return {filter.root(), nestingLimit};
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,36 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/JsonFloat.hpp>
+#include <ArduinoJson/Numbers/JsonInteger.hpp>
+#include <ArduinoJson/Strings/JsonString.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Receives the events of parseJson() and parseMsgPack().
+// Derive from this class and hide the functions you're interested in; the
+// calls are resolved at compile time, so there is no virtual function.
+// The strings are only valid during the call.
+struct JsonEventHandler {
+  void onStartObject() {}
+  void onKey(JsonString) {}
+  void onEndObject() {}
+
+  void onStartArray() {}
+  void onEndArray() {}
+
+  void onNull() {}
+  void onBoolean(bool) {}
+  void onInteger(JsonInteger) {}
+  void onUnsignedInteger(JsonUInt) {}
+  void onFloat(JsonFloat) {}
+  void onString(JsonString) {}
+
+  // MessagePack's binaries and extensions, with their header
+  void onRawString(JsonString) {}
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
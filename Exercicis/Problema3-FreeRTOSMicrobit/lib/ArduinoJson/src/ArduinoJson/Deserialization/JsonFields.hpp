@@ -0,0 +1,244 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/EventHandler.hpp>
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+#  include <string>
+#endif
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// The table of the members that JsonStructHandler<T> can write.
+// Specialize it with ARDUINOJSON_FIELDS_BEGIN(), ARDUINOJSON_FIELD(), and
+// ARDUINOJSON_FIELDS_END(), at global scope:
+//   ARDUINOJSON_FIELDS_BEGIN(Command)
+//   ARDUINOJSON_FIELD(id)
+//   ARDUINOJSON_FIELD_NAMED(speed, "spd")
+//   ARDUINOJSON_FIELDS_END()
+template <typename T>
+struct JsonFields;
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// stringHash() at compile time, for the case labels of JsonFields.
+// Two names with the same hash don't compile ("duplicate case value"), so
+// the switch is a perfect hash of the names.
+constexpr uint32_t fieldHash(const char* s, uint32_t hash = 2166136261u) {
+  return *s ? fieldHash(s + 1, (hash ^ static_cast<uint8_t>(*s)) * 16777619u)
+            : hash;
+}
+
+// Writes a value to a member, if it fits
+template <typename T, typename TValue, typename Enable = void>
+struct FieldAssigner {
+  static bool assign(T&, TValue) {
+    return false;
+  }
+};
+
+template <typename T>
+struct is_number
+    : bool_constant<(is_integral<T>::value || is_floating_point<T>::value) &&
+                    !is_same<T, bool>::value> {};
+
+template <typename T, typename TValue>
+struct FieldAssigner<
+    T, TValue, enable_if_t<is_number<T>::value && is_number<TValue>::value>> {
+  static bool assign(T& field, TValue value) {
+    if (!canConvertNumber<T>(value))
+      return false;
+    field = convertNumber<T>(value);
+    return true;
+  }
+};
+
+template <>
+struct FieldAssigner<bool, bool> {
+  static bool assign(bool& field, bool value) {
+    field = value;
+    return true;
+  }
+};
+
+// The strings that don't fit are skipped, not truncated
+template <size_t N>
+struct FieldAssigner<char[N], JsonString> {
+  static bool assign(char (&field)[N], JsonString value) {
+    if (value.size() >= N)
+      return false;
+    memcpy(field, value.c_str(), value.size());
+    field[value.size()] = 0;
+    return true;
+  }
+};
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+template <>
+struct FieldAssigner<std::string, JsonString> {
+  static bool assign(std::string& field, JsonString value) {
+    field.assign(value.c_str(), value.size());
+    return true;
+  }
+};
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+template <>
+struct FieldAssigner<::String, JsonString> {
+  static bool assign(::String& field, JsonString value) {
+    field = value.c_str();
+    return true;
+  }
+};
+#endif
+
+// Tells if a key names a member, without touching it
+struct FieldFinder {
+  template <typename T>
+  bool operator()(T&) const {
+    return true;
+  }
+};
+
+template <typename TValue>
+class FieldWriter {
+ public:
+  explicit FieldWriter(TValue value) : value_(value) {}
+
+  template <typename T>
+  bool operator()(T& field) const {
+    return FieldAssigner<T, TValue>::assign(field, value_);
+  }
+
+ private:
+  TValue value_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Fills a struct described by JsonFields<T> from the events of parseJson()
+// or parseMsgPack(), without a JsonDocument.
+// The root must be an object. The values of the unknown keys are skipped,
+// as well as the nulls, arrays, objects, and values that don't fit in their
+// member. The members can be numbers, bool, char[N], or strings.
+template <typename T>
+class JsonStructHandler : public JsonEventHandler {
+ public:
+  explicit JsonStructHandler(T& obj) : obj_(obj) {}
+
+  // Returns the number of values written to the struct
+  size_t fieldCount() const {
+    return count_;
+  }
+
+  void onStartObject() {
+    enter();
+  }
+
+  void onEndObject() {
+    depth_--;
+  }
+
+  void onStartArray() {
+    enter();
+  }
+
+  void onEndArray() {
+    depth_--;
+  }
+
+  void onKey(JsonString key) {
+    if (depth_ != 1)
+      return;
+    hash_ = detail::stringHash(detail::adaptString(key));
+    pending_ = JsonFields<T>::visit(obj_, hash_, key, detail::FieldFinder());
+  }
+
+  void onBoolean(bool value) {
+    write(value);
+  }
+
+  void onInteger(JsonInteger value) {
+    write(value);
+  }
+
+  void onUnsignedInteger(JsonUInt value) {
+    write(value);
+  }
+
+  void onFloat(JsonFloat value) {
+    write(value);
+  }
+
+  void onString(JsonString value) {
+    write(value);
+  }
+
+ private:
+  void enter() {
+    pending_ = false;
+    depth_++;
+  }
+
+  template <typename TValue>
+  void write(TValue value) {
+    if (depth_ != 1 || !pending_)
+      return;
+    pending_ = false;
+    // the key was checked by onKey(), so the hash is enough
+    if (JsonFields<T>::visit(obj_, hash_, JsonString(),
+                             detail::FieldWriter<TValue>(value)))
+      count_++;
+  }
+
+  T& obj_;
+  size_t depth_ = 0;
+  size_t count_ = 0;
+  uint32_t hash_ = 0;
+  bool pending_ = false;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+// Starts the specialization of JsonFields<T>; must be used at global scope
+#define ARDUINOJSON_FIELDS_BEGIN(T)                          \
+  namespace ArduinoJson {                                    \
+  template <>                                                \
+  struct JsonFields<T> {                                     \
+    template <typename TVisitor>                             \
+    static bool visit(T& obj, uint32_t hash, JsonString key, \
+                      const TVisitor& visitor) {             \
+      (void)obj;                                             \
+      (void)key;                                             \
+      (void)visitor;                                         \
+      switch (hash) {
+
+// Maps the key "name" to the member obj.member
+#define ARDUINOJSON_FIELD_NAMED(member, name)     \
+  case ::ArduinoJson::detail::fieldHash(name):    \
+    if (!key.isNull() && key != JsonString(name)) \
+      return false;                               \
+    return visitor(obj.member);
+
+// Maps the key "member" to the member of the same name
+#define ARDUINOJSON_FIELD(member) ARDUINOJSON_FIELD_NAMED(member, #member)
+
+// Ends the specialization of JsonFields<T>
+#define ARDUINOJSON_FIELDS_END() \
+  }                              \
+  return false;                  \
+  }                              \
+  }                              \
+  ;                              \
+  }
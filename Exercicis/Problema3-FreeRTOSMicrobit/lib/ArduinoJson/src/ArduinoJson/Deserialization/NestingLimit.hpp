@@ -24,6 +24,10 @@ class NestingLimit {
     return value_ == 0;
   }
 
+  uint8_t value() const {
+    return value_;
+  }
+
  private:
   uint8_t value_;
 };
@@ -39,6 +39,8 @@ struct BoundedReader {
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
 
+#include <ArduinoJson/Deserialization/Readers/BufferedReader.hpp>
+#include <ArduinoJson/Deserialization/Readers/InPlaceReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/IteratorReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/RamReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/VariantReader.hpp>
@@ -59,6 +61,10 @@ ARDUINOJSON_END_PRIVATE_NAMESPACE
 #  include <ArduinoJson/Deserialization/Readers/StdStreamReader.hpp>
 #endif
 
+#if ARDUINOJSON_ENABLE_MMAP
+#  include <ArduinoJson/Deserialization/Readers/MappedFileReader.hpp>
+#endif
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 template <typename TInput>
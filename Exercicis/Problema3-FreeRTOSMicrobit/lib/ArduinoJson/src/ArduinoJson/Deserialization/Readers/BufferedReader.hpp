@@ -0,0 +1,69 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A reader is bufferable if it can read ahead and give back what wasn't used:
+//   size_t readAhead(char* buffer, size_t length);
+//   void unread(size_t length);
+template <typename TReader, typename = void>
+struct IsBufferable : false_type {};
+
+template <typename TReader>
+struct IsBufferable<TReader, void_t<decltype(declval<TReader&>().readAhead(
+                                 declval<char*>(), size_t()))>>
+    : true_type {};
+
+// Serves the characters from a window filled in bulk with readAhead().
+// The characters that remain in the window are given back to the source in
+// the destructor, so it never consumes more than the deserializer did.
+template <typename TReader>
+class BufferedReader {
+ public:
+  explicit BufferedReader(TReader reader) : reader_(reader) {}
+  BufferedReader(const BufferedReader&) = delete;
+  BufferedReader& operator=(const BufferedReader&) = delete;
+
+  ~BufferedReader() {
+    reader_.unread(size_ - position_);
+  }
+
+  int read() {
+    if (position_ == size_ && !fill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[position_++]);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = size_ - position_;
+    if (n > length)
+      n = length;
+    memcpy(buffer, buffer_ + position_, n);
+    position_ += n;
+    if (n < length)  // the window is empty: read the rest directly
+      n += reader_.readBytes(buffer + n, length - n);
+    return n;
+  }
+
+ private:
+  bool fill() {
+    size_ = reader_.readAhead(buffer_, sizeof(buffer_));
+    position_ = 0;
+    return size_ > 0;
+  }
+
+  TReader reader_;
+  size_t position_ = 0;
+  size_t size_ = 0;
+  char buffer_[ARDUINOJSON_READER_BUFFER_SIZE];
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,93 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A mutable input buffer that the deserializer can modify
+class InPlaceInput {
+ public:
+  // end is nullptr if the input is null-terminated
+  InPlaceInput(char* begin, char* end) : begin_(begin), end_(end) {}
+
+  char* begin() const {
+    return begin_;
+  }
+
+  char* end() const {
+    return end_;
+  }
+
+ private:
+  char* begin_;
+  char* end_;
+};
+
+template <>
+struct Reader<InPlaceInput> {
+ public:
+  explicit Reader(InPlaceInput input)
+      : buffer_(input.begin()), ptr_(input.begin()), end_(input.end()) {}
+
+  int read() {
+    if (ptr_ == end_)
+      return -1;
+    return static_cast<unsigned char>(*ptr_++);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t i = 0;
+    while (i < length && ptr_ != end_)
+      buffer[i++] = *ptr_++;
+    return i;
+  }
+
+  const char* cursor() const {
+    return ptr_;
+  }
+
+  const char* limit() const {
+    return end_;
+  }
+
+  void advance(const char* p) {
+    ptr_ += p - ptr_;  // same as ptr_ = p, without the const_cast
+  }
+
+  // Where the decoded strings are written, behind the reading position
+  char* buffer() const {
+    return buffer_;
+  }
+
+ private:
+  char* buffer_;
+  char* ptr_;
+  char* end_;
+};
+
+template <typename TReader>
+struct IsInPlaceReader : is_same<TReader, Reader<InPlaceInput>> {};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Lets deserializeJson() decode the strings in the input buffer and store
+// pointers to them instead of copies.
+// deserializeMsgPack() moves each string one byte back to terminate it, and
+// links the binaries and extensions where they are; it needs the size of the
+// input and returns IncompleteInput for these values with inPlace(char*).
+// The buffer is modified and must outlive the JsonDocument.
+inline detail::InPlaceInput inPlace(char* buffer) {
+  return detail::InPlaceInput(buffer, nullptr);
+}
+
+inline detail::InPlaceInput inPlace(char* buffer, size_t size) {
+  return detail::InPlaceInput(buffer, buffer + size);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -8,6 +8,18 @@
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+// A reader is contiguous if it gives direct access to the remaining input:
+//   const char* cursor() const;
+//   const char* limit() const;  // nullptr if null-terminated
+//   void advance(const char* p);
+template <typename TReader, typename = void>
+struct IsContiguousReader : false_type {};
+
+template <typename TReader>
+struct IsContiguousReader<
+    TReader, enable_if_t<is_same<decltype(declval<const TReader&>().cursor()),
+                                 const char*>::value>> : true_type {};
+
 template <typename TIterator>
 class IteratorReader {
   TIterator ptr_, end_;
@@ -29,14 +41,57 @@ class IteratorReader {
       buffer[i++] = *ptr_++;
     return i;
   }
+
+  TIterator cursor() const {
+    return ptr_;
+  }
+
+  TIterator limit() const {
+    return end_;
+  }
+
+  void advance(TIterator p) {
+    ptr_ = p;
+  }
+};
+
+// Containers that store the characters contiguously (std::string,
+// std::string_view...) are read through a pointer
+template <typename TSource, typename = void>
+struct ContainerIterator {
+  using type = typename TSource::const_iterator;
+
+  static type begin(const TSource& source) {
+    return source.begin();
+  }
+
+  static type end(const TSource& source) {
+    return source.end();
+  }
+};
+
+template <typename TSource>
+struct ContainerIterator<
+    TSource, enable_if_t<is_same<decltype(declval<const TSource&>().data()),
+                                 const char*>::value>> {
+  using type = const char*;
+
+  static type begin(const TSource& source) {
+    return source.data();
+  }
+
+  static type end(const TSource& source) {
+    return source.data() + source.size();
+  }
 };
 
 template <typename TSource>
 struct Reader<TSource, void_t<typename TSource::const_iterator>>
-    : IteratorReader<typename TSource::const_iterator> {
+    : IteratorReader<typename ContainerIterator<TSource>::type> {
   explicit Reader(const TSource& source)
-      : IteratorReader<typename TSource::const_iterator>(source.begin(),
-                                                         source.end()) {}
+      : IteratorReader<typename ContainerIterator<TSource>::type>(
+            ContainerIterator<TSource>::begin(source),
+            ContainerIterator<TSource>::end(source)) {}
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,91 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A file mapped in memory, which deserializeJson() and deserializeMsgPack()
+// read without copying it first.
+// The mapping is private: inPlace() lets the deserializers keep the strings
+// in the mapped pages, which are then copied on write, so the file doesn't
+// change. In that case, the MappedFile must outlive the JsonDocument.
+class MappedFile {
+ public:
+  explicit MappedFile(const char* path) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+      return;
+    struct stat st;
+    if (::fstat(fd, &st) == 0) {
+      if (st.st_size == 0) {
+        open_ = true;
+      } else {
+        void* p = ::mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+          data_ = static_cast<char*>(p);
+          size_ = size_t(st.st_size);
+          open_ = true;
+#ifdef MADV_SEQUENTIAL
+          ::madvise(p, size_, MADV_SEQUENTIAL);
+#endif
+        }
+      }
+    }
+    ::close(fd);  // the mapping stays valid
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() {
+    if (data_)
+      ::munmap(data_, size_);
+  }
+
+  // Returns false if the file couldn't be opened or mapped
+  bool isOpen() const {
+    return open_;
+  }
+
+  const char* data() const {
+    return data_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  // Lets the deserializers keep the strings in the mapping
+  detail::InPlaceInput inPlace() {
+    return detail::InPlaceInput(data_, data_ + size_);
+  }
+
+ private:
+  char* data_ = nullptr;
+  size_t size_ = 0;
+  bool open_ = false;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+template <typename TSource>
+struct Reader<TSource, enable_if_t<is_same<remove_cv_t<TSource>,
+                                           MappedFile>::value>>
+    : IteratorReader<const char*> {
+  explicit Reader(const MappedFile& file)
+      : IteratorReader<const char*>(file.data(), file.data() + file.size()) {}
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
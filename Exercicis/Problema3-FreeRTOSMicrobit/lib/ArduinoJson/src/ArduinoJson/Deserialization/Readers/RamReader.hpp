@@ -35,6 +35,18 @@ struct Reader<TSource*, enable_if_t<IsCharOrVoid<TSource>::value>> {
       buffer[i] = *ptr_++;
     return length;
   }
+
+  const char* cursor() const {
+    return ptr_;
+  }
+
+  const char* limit() const {
+    return nullptr;
+  }
+
+  void advance(const char* p) {
+    ptr_ = p;
+  }
 };
 
 template <typename TSource>
@@ -22,6 +22,32 @@ struct Reader<TSource, enable_if_t<is_base_of<std::istream, TSource>::value>> {
     return static_cast<size_t>(stream_->gcount());
   }
 
+  // Only reads the characters that are already in the stream buffer, so that
+  // unread() can always put them back.
+  // These characters are taken from the stream buffer directly, which
+  // doesn't touch the state of the stream. Past them, it falls back to get(),
+  // so reading beyond the end sets eofbit and failbit as before.
+  size_t readAhead(char* buffer, size_t length) {
+    auto streamBuffer = stream_->rdbuf();
+    auto available = streamBuffer->in_avail();
+    if (available <= 0) {  // buffer empty or unbuffered stream
+      int c = read();
+      if (c < 0)
+        return 0;
+      buffer[0] = static_cast<char>(c);
+      return 1;
+    }
+    if (length > static_cast<size_t>(available))
+      length = static_cast<size_t>(available);
+    return static_cast<size_t>(
+        streamBuffer->sgetn(buffer, static_cast<std::streamsize>(length)));
+  }
+
+  void unread(size_t length) {
+    while (length--)
+      stream_->rdbuf()->sungetc();
+  }
+
  private:
   std::istream* stream_;
 };
@@ -4,13 +4,17 @@
 
 #pragma once
 
+#include <ArduinoJson/Deserialization/CompiledFilter.hpp>
 #include <ArduinoJson/Deserialization/DeserializationError.hpp>
-#include <ArduinoJson/Deserialization/DeserializationOptions.hpp>
+#include <ArduinoJson/Deserialization/EventHandler.hpp>
 #include <ArduinoJson/Deserialization/Reader.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+class ResourceManager;
+class VariantData;
+
 // A meta-function that returns the first type of the parameter pack
 // or void if empty
 template <typename...>
@@ -36,10 +40,62 @@ inline void shrinkJsonDocument(TDestination&) {
 
 #if ARDUINOJSON_AUTO_SHRINK
 inline void shrinkJsonDocument(JsonDocument& doc) {
-  doc.shrinkToFit();
+  // a recycled document keeps its capacity for the next message
+  if (!VariantAttorney::getResourceManager(doc)->recycling())
+    doc.shrinkToFit();
 }
 #endif
 
+template <typename TDestination>
+inline void clearDestination(TDestination& dst) {
+  dst.clear();
+}
+
+inline void clearDestination(JsonDocument& doc) {
+  if (VariantAttorney::getResourceManager(doc)->recycling())
+    doc.recycle();
+  else
+    doc.clear();
+}
+
+template <template <typename> class TDeserializer, typename TReader,
+          typename TOptions,
+          enable_if_t<!IsBufferable<TReader>::value, int> = 0>
+DeserializationError parseReader(ResourceManager* resources, TReader reader,
+                                 VariantData& data, TOptions options) {
+  return TDeserializer<TReader>(resources, reader)
+      .parse(data, options.filter, options.nestingLimit);
+}
+
+template <template <typename> class TDeserializer, typename TReader,
+          typename TOptions, enable_if_t<IsBufferable<TReader>::value, int> = 0>
+DeserializationError parseReader(ResourceManager* resources, TReader reader,
+                                 VariantData& data, TOptions options) {
+  BufferedReader<TReader> bufferedReader(reader);
+  return parseReader<TDeserializer>(resources, makeReader(bufferedReader), data,
+                                    options);
+}
+
+template <template <typename> class TDeserializer, typename TReader,
+          typename THandler,
+          enable_if_t<!IsBufferable<TReader>::value, int> = 0>
+DeserializationError parseEvents(
+    ResourceManager* resources, TReader reader, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit) {
+  return TDeserializer<TReader>(resources, reader)
+      .parseEvents(handler, nestingLimit);
+}
+
+template <template <typename> class TDeserializer, typename TReader,
+          typename THandler, enable_if_t<IsBufferable<TReader>::value, int> = 0>
+DeserializationError parseEvents(
+    ResourceManager* resources, TReader reader, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit) {
+  BufferedReader<TReader> bufferedReader(reader);
+  return parseEvents<TDeserializer>(resources, makeReader(bufferedReader),
+                                    handler, nestingLimit);
+}
+
 template <template <typename> class TDeserializer, typename TDestination,
           typename TReader, typename TOptions>
 DeserializationError doDeserialize(TDestination&& dst, TReader reader,
@@ -48,10 +104,11 @@ DeserializationError doDeserialize(TDestination&& dst, TReader reader,
   if (!data)
     return DeserializationError::NoMemory;
   auto resources = VariantAttorney::getResourceManager(dst);
-  dst.clear();
-  auto err = TDeserializer<TReader>(resources, reader)
-                 .parse(*data, options.filter, options.nestingLimit);
+  clearDestination(dst);
+  auto err = parseReader<TDeserializer>(resources, reader, *data, options);
   shrinkJsonDocument(dst);
+  if (!err)
+    data->buildIndex(resources);  // shrinkToFit() dropped it
   return err;
 }
 
@@ -61,7 +118,7 @@ template <
     enable_if_t<  // issue #1897
         !is_integral<typename first_or_void<Args...>::type>::value, int> = 0>
 DeserializationError deserialize(TDestination&& dst, TStream&& input,
-                                 Args... args) {
+                                 const Args&... args) {
   return doDeserialize<TDeserializer>(
       dst, makeReader(detail::forward<TStream>(input)),
       makeDeserializationOptions(args...));
@@ -71,7 +128,7 @@ template <template <typename> class TDeserializer, typename TDestination,
           typename TChar, typename Size, typename... Args,
           enable_if_t<is_integral<Size>::value, int> = 0>
 DeserializationError deserialize(TDestination&& dst, TChar* input,
-                                 Size inputSize, Args... args) {
+                                 Size inputSize, const Args&... args) {
   return doDeserialize<TDeserializer>(dst, makeReader(input, size_t(inputSize)),
                                       makeDeserializationOptions(args...));
 }
@@ -61,7 +61,18 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
   }
 
   Allocator* allocator() const {
-    return resources_.allocator();
+    return resources_.sourceAllocator();
+  }
+
+  // Returns the allocation counters and the occupancy of the memory pools.
+  // Define ARDUINOJSON_ENABLE_STATS to 1 to collect them.
+  ResourceStats stats() const {
+    return resources_.stats();
+  }
+
+  // Restarts the counters, for example before a workload to measure
+  void resetStats() {
+    resources_.resetStats();
   }
 
   // Reduces the capacity of the memory pool to match the current usage.
@@ -70,6 +81,28 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
     resources_.shrinkToFit();
   }
 
+  // Moves the values to dense memory pools, in document order, and releases
+  // the old pools, including the slots freed by remove().
+  // It temporarily needs memory for a second copy of the values.
+  // Returns false if there wasn't enough memory; the document is unchanged.
+  bool compact() {
+    return resources_.compact(&data_);
+  }
+
+  // Calls compact(), which puts the children of each array or object in
+  // consecutive slots. Until the next change, lookups don't update the
+  // indexes, so the document can be read from several threads, and arrays
+  // support random access.
+  // Returns false if there wasn't enough memory; the document is unchanged.
+  bool freeze() {
+    return resources_.freeze(&data_);
+  }
+
+  // Returns true if the document hasn't changed since freeze()
+  bool isFrozen() const {
+    return resources_.frozen();
+  }
+
   // Casts the root to the specified type.
   // https://arduinojson.org/v7/api/jsondocument/as/
   template <typename T>
@@ -91,6 +124,16 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
     data_.reset();
   }
 
+  // Empties the document but keeps the memory pools for the next values.
+  // Strings are still released.
+  // Until the next clear() or shrinkToFit(), deserializeJson() and
+  // deserializeMsgPack() recycle the document instead of clearing it and
+  // don't shrink it.
+  void recycle() {
+    resources_.recycle();
+    data_.reset();
+  }
+
   // Returns true if the root is of the specified type.
   // https://arduinojson.org/v7/api/jsondocument/is/
   template <typename T>
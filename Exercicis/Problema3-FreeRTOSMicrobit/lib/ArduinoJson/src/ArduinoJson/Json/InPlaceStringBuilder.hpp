@@ -0,0 +1,70 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Strings/JsonString.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <string.h>  // memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Decodes the strings in the input buffer instead of copying them to the pool.
+// A decoded string is never longer than its JSON representation (quotes
+// included), so the writing position always stays behind the reading position.
+class InPlaceStringBuilder {
+ public:
+  InPlaceStringBuilder(char* buffer) : output_(buffer) {}
+
+  void startString() {
+    size_ = 0;
+    hasNul_ = false;
+  }
+
+  // Returns a static string, unless it contains a NUL: linked strings are
+  // null-terminated, so such a string must be copied to the pool
+  RamString save() {
+    output_[size_] = 0;
+    RamString s(output_, size_, !hasNul_);
+    output_ += size_ + 1;
+    return s;
+  }
+
+  void append(const char* s) {
+    while (*s)
+      append(*s++);
+  }
+
+  void append(const char* s, size_t n) {
+    memmove(output_ + size_, s, n);
+    size_ += n;
+  }
+
+  void append(char c) {
+    if (c == 0)
+      hasNul_ = true;
+    output_[size_++] = c;
+  }
+
+  bool isValid() const {
+    return true;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  JsonString str() const {
+    output_[size_] = 0;
+    return JsonString(output_, size_);
+  }
+
+ private:
+  char* output_;
+  size_t size_ = 0;
+  bool hasNul_ = false;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,103 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stddef.h>  // size_t
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Bulk scanning of inputs that are in RAM, one word at a time ("SIMD within a
+// register"), so it works on any CPU.
+class InputScanner {
+ public:
+  // Returns the first character that must be handled one at a time in a
+  // string: the closing quote, a backslash, or a null terminator.
+  // If end is nullptr, the input is null-terminated.
+  static const char* findSpecialChar(const char* p, const char* end,
+                                     char quote) {
+    if (end) {
+      // reading a word past the terminator would overflow the input, so we
+      // only do that when the size is known
+      const size_t quotes = broadcast(quote);
+      const size_t backslashes = broadcast('\\');
+      while (end - p >= static_cast<ptrdiff_t>(sizeof(size_t))) {
+        size_t word;
+        memcpy(&word, p, sizeof(word));
+        if (hasZeroByte(word) || hasZeroByte(word ^ quotes) ||
+            hasZeroByte(word ^ backslashes))
+          break;
+        p += sizeof(size_t);
+      }
+      while (p < end && *p != quote && *p != '\\' && *p != '\0')
+        p++;
+    } else {
+      while (*p != quote && *p != '\\' && *p != '\0')
+        p++;
+    }
+    return p;
+  }
+
+  // Returns the first character that TextFormatter must handle one at a time:
+  // a quote, a backslash, or a control character (including the null
+  // terminator). If end is nullptr, the input is null-terminated.
+  static const char* findCharToEscape(const char* p, const char* end) {
+    if (end) {
+      const size_t quotes = broadcast('"');
+      const size_t backslashes = broadcast('\\');
+      while (end - p >= static_cast<ptrdiff_t>(sizeof(size_t))) {
+        size_t word;
+        memcpy(&word, p, sizeof(word));
+        if (hasByteLessThan(word, 0x20) || hasZeroByte(word ^ quotes) ||
+            hasZeroByte(word ^ backslashes))
+          break;
+        p += sizeof(size_t);
+      }
+      while (p < end && !needsEscaping(*p))
+        p++;
+    } else {
+      while (!needsEscaping(*p))
+        p++;
+    }
+    return p;
+  }
+
+  // Returns the first character that is not a space, a tab or a line break.
+  // If end is nullptr, the input is null-terminated.
+  static const char* skipSpaces(const char* p, const char* end) {
+    while (p != end && isSpace(*p))
+      p++;
+    return p;
+  }
+
+ private:
+  static constexpr size_t ones = static_cast<size_t>(-1) / 0xFF;  // 0x0101...
+
+  static size_t broadcast(char c) {
+    return ones * static_cast<unsigned char>(c);
+  }
+
+  // Non-zero if one of the bytes of the word is zero
+  static size_t hasZeroByte(size_t word) {
+    return (word - ones) & ~word & (ones << 7);
+  }
+
+  // Non-zero if one of the bytes of the word is less than n (n <= 0x80)
+  static size_t hasByteLessThan(size_t word, unsigned char n) {
+    return (word - ones * n) & ~word & (ones << 7);
+  }
+
+  static bool needsEscaping(char c) {
+    return static_cast<unsigned char>(c) < 0x20 || c == '"' || c == '\\';
+  }
+
+  static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
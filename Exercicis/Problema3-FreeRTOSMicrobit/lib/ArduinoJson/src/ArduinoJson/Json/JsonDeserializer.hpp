@@ -6,23 +6,34 @@
 
 #include <ArduinoJson/Deserialization/deserialize.hpp>
 #include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/InPlaceStringBuilder.hpp>
+#include <ArduinoJson/Json/InputScanner.hpp>
 #include <ArduinoJson/Json/Latch.hpp>
 #include <ArduinoJson/Json/Utf16.hpp>
 #include <ArduinoJson/Json/Utf8.hpp>
 #include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuilder.hpp>
 #include <ArduinoJson/Numbers/parseNumber.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 #include <ArduinoJson/Variant/VariantData.hpp>
 
+#include <string.h>  // strchr
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 template <typename TReader>
 class JsonDeserializer {
+  // in-place inputs get their strings decoded in the input buffer
+  using string_builder_type =
+      conditional_t<IsInPlaceReader<TReader>::value, InPlaceStringBuilder,
+                    StringBuilder>;
+
  public:
   JsonDeserializer(ResourceManager* resources, TReader reader)
-      : stringBuilder_(resources),
+      : stringBuilder_(
+            stringBuilderArg(resources, reader, IsInPlaceReader<TReader>())),
         foundSomething_(false),
         latch_(reader),
         resources_(resources) {}
@@ -42,6 +53,28 @@ class JsonDeserializer {
     return err;
   }
 
+  template <typename THandler>
+  DeserializationError parseEvents(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // a number is the only value that needs a character after it to end
+    bool isNumber = !strchr("[{\"'tfn", current());
+
+    err = emitVariant(handler, nestingLimit);
+
+    if (!err && isNumber && latch_.last() != 0) {
+      // Same as parse(): we don't detect trailing characters earlier
+      return DeserializationError::InvalidInput;
+    }
+
+    return err;
+  }
+
  private:
   char current() {
     return latch_.current();
@@ -111,6 +144,53 @@ class JsonDeserializer {
     }
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitVariant(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    switch (current()) {
+      case '[':
+        return emitArray(handler, nestingLimit);
+
+      case '{':
+        return emitObject(handler, nestingLimit);
+
+      case '\"':
+      case '\'':
+        stringBuilder_.startString();
+        err = parseQuotedString();
+        if (!err)
+          handler.onString(stringBuilder_.str());
+        return err;
+
+      case 't':
+        err = skipKeyword("true");
+        if (!err)
+          handler.onBoolean(true);
+        return err;
+
+      case 'f':
+        err = skipKeyword("false");
+        if (!err)
+          handler.onBoolean(false);
+        return err;
+
+      case 'n':
+        err = skipKeyword("null");
+        if (!err)
+          handler.onNull();
+        return err;
+
+      default:
+        return emitNumericValue(handler);
+    }
+  }
+
   DeserializationError::Code skipVariant(
       DeserializationOption::NestingLimit nestingLimit) {
     DeserializationError::Code err;
@@ -199,6 +279,50 @@ class JsonDeserializer {
     }
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitArray(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening braket
+    ARDUINOJSON_ASSERT(current() == '[');
+    move();
+    handler.onStartArray();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Empty array?
+    if (!eat(']')) {
+      // Read each value
+      for (;;) {
+        // 1 - Parse value
+        err = emitVariant(handler, nestingLimit.decrement());
+        if (err)
+          return err;
+
+        // 2 - Skip spaces
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        // 3 - More values?
+        if (eat(']'))
+          break;
+        if (!eat(','))
+          return DeserializationError::InvalidInput;
+      }
+    }
+
+    handler.onEndArray();
+    return DeserializationError::Ok;
+  }
+
   DeserializationError::Code skipArray(
       DeserializationOption::NestingLimit nestingLimit) {
     DeserializationError::Code err;
@@ -314,6 +438,71 @@ class JsonDeserializer {
     }
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitObject(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening brace
+    ARDUINOJSON_ASSERT(current() == '{');
+    move();
+    handler.onStartObject();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Empty object?
+    if (!eat('}')) {
+      // Read each key value pair
+      for (;;) {
+        // Parse key
+        err = parseKey();
+        if (err)
+          return err;
+
+        // Skip spaces
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        // Colon
+        if (!eat(':'))
+          return DeserializationError::InvalidInput;
+
+        handler.onKey(stringBuilder_.str());
+
+        // Parse value
+        err = emitVariant(handler, nestingLimit.decrement());
+        if (err)
+          return err;
+
+        // Skip spaces
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        // More keys/values?
+        if (eat('}'))
+          break;
+        if (!eat(','))
+          return DeserializationError::InvalidInput;
+
+        // Skip spaces
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+      }
+    }
+
+    handler.onEndObject();
+    return DeserializationError::Ok;
+  }
+
   DeserializationError::Code skipObject(
       DeserializationOption::NestingLimit nestingLimit) {
     DeserializationError::Code err;
@@ -390,7 +579,8 @@ class JsonDeserializer {
     if (err)
       return err;
 
-    variant.setOwnedString(stringBuilder_.save());
+    if (!variant.setString(stringBuilder_.save(), resources_))
+      return DeserializationError::NoMemory;
 
     return DeserializationError::Ok;
   }
@@ -404,6 +594,8 @@ class JsonDeserializer {
 
     move();
     for (;;) {
+      appendPlainChars(stopChar, IsContiguousReader<TReader>());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -429,6 +621,8 @@ class JsonDeserializer {
             Utf8::encodeCodepoint(codepoint.value(), stringBuilder_);
 #else
           stringBuilder_.append('\\');
+          stringBuilder_.append('u');
+          move();
 #endif
           continue;
         }
@@ -482,6 +676,8 @@ class JsonDeserializer {
 
     move();
     for (;;) {
+      skipPlainChars(stopChar, IsContiguousReader<TReader>());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -489,14 +685,53 @@ class JsonDeserializer {
       if (c == '\0')
         return DeserializationError::IncompleteInput;
       if (c == '\\') {
-        if (current() != '\0')
-          move();
+        if (current() == '\0')
+          return DeserializationError::IncompleteInput;
+        move();
       }
     }
 
     return DeserializationError::Ok;
   }
 
+  // When the input is in RAM, copy the characters up to the next quote or
+  // backslash in one go
+  void appendPlainChars(char stopChar, true_type) {
+    auto& reader = latch_.reader();
+    const char* begin = reader.cursor();
+    const char* end =
+        InputScanner::findSpecialChar(begin, reader.limit(), stopChar);
+    stringBuilder_.append(begin, size_t(end - begin));
+    reader.advance(end);
+  }
+
+  void appendPlainChars(char, false_type) {}
+
+  void skipPlainChars(char stopChar, true_type) {
+    auto& reader = latch_.reader();
+    reader.advance(InputScanner::findSpecialChar(reader.cursor(),
+                                                 reader.limit(), stopChar));
+  }
+
+  void skipPlainChars(char, false_type) {}
+
+  void skipSpaces(true_type) {
+    auto& reader = latch_.reader();
+    reader.advance(InputScanner::skipSpaces(reader.cursor(), reader.limit()));
+  }
+
+  void skipSpaces(false_type) {}
+
+  static ResourceManager* stringBuilderArg(ResourceManager* resources,
+                                           TReader&, false_type) {
+    return resources;
+  }
+
+  static char* stringBuilderArg(ResourceManager*, TReader& reader,
+                                true_type) {
+    return reader.buffer();
+  }
+
   DeserializationError::Code skipNonQuotedString() {
     char c = current();
     while (canBeInNonQuotedString(c)) {
@@ -506,7 +741,7 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  DeserializationError::Code parseNumericValue(VariantData& result) {
+  Number readNumber() {
     uint8_t n = 0;
 
     char c = current();
@@ -517,7 +752,11 @@ class JsonDeserializer {
     }
     buffer_[n] = 0;
 
-    auto number = parseNumber(buffer_);
+    return parseNumber(buffer_);
+  }
+
+  DeserializationError::Code parseNumericValue(VariantData& result) {
+    auto number = readNumber();
     switch (number.type()) {
       case NumberType::UnsignedInteger:
         if (result.setInteger(number.asUnsignedInteger(), resources_))
@@ -550,6 +789,33 @@ class JsonDeserializer {
     }
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitNumericValue(THandler& handler) {
+    auto number = readNumber();
+    switch (number.type()) {
+      case NumberType::UnsignedInteger:
+        handler.onUnsignedInteger(number.asUnsignedInteger());
+        return DeserializationError::Ok;
+
+      case NumberType::SignedInteger:
+        handler.onInteger(number.asSignedInteger());
+        return DeserializationError::Ok;
+
+      case NumberType::Float:
+        handler.onFloat(number.asFloat());
+        return DeserializationError::Ok;
+
+#if ARDUINOJSON_USE_DOUBLE
+      case NumberType::Double:
+        handler.onFloat(number.asDouble());
+        return DeserializationError::Ok;
+#endif
+
+      default:
+        return DeserializationError::InvalidInput;
+    }
+  }
+
   DeserializationError::Code skipNumericValue() {
     char c = current();
     while (canBeInNumber(c)) {
@@ -617,6 +883,7 @@ class JsonDeserializer {
         case '\r':
         case '\n':
           move();
+          skipSpaces(IsContiguousReader<TReader>());
           continue;
 
 #if ARDUINOJSON_ENABLE_COMMENTS
@@ -682,7 +949,7 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  StringBuilder stringBuilder_;
+  string_builder_type stringBuilder_;
   bool foundSomething_;
   Latch<TReader> latch_;
   ResourceManager* resources_;
@@ -719,4 +986,74 @@ inline DeserializationError deserializeJson(TDestination&& dst, TChar* input,
                                        input, detail::forward<Args>(args)...);
 }
 
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TInput, typename THandler>
+inline DeserializationError parseJson(
+    TInput&& input, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<JsonDeserializer>(
+      &resources, makeReader(detail::forward<TInput>(input)), handler,
+      nestingLimit);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TInput, typename THandler>
+inline DeserializationError parseJson(
+    TInput&& input, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseJson(detail::forward<TInput>(input), handler,
+                   detail::DefaultAllocator::instance(), nestingLimit);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TChar, typename THandler>
+inline DeserializationError parseJson(
+    TChar* input, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<JsonDeserializer>(&resources, makeReader(input), handler,
+                                       nestingLimit);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TChar, typename THandler>
+inline DeserializationError parseJson(
+    TChar* input, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseJson(input, handler, detail::DefaultAllocator::instance(),
+                   nestingLimit);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TChar, typename THandler>
+inline DeserializationError parseJson(
+    TChar* input, size_t inputSize, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<JsonDeserializer>(
+      &resources, makeReader(input, inputSize), handler, nestingLimit);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TChar, typename THandler>
+inline DeserializationError parseJson(
+    TChar* input, size_t inputSize, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseJson(input, inputSize, handler,
+                   detail::DefaultAllocator::instance(), nestingLimit);
+}
+
 ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,503 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON document that arrives in fragments, without buffering it.
+// feed() puts the values in the JsonDocument as soon as they are complete and
+// returns IncompleteInput until the document ends. The parse stack and the
+// string being read stay in the parser between the calls, so a call never
+// waits for the rest of the document.
+// After Ok, consumed() tells how many bytes of the last fragment belonged to
+// the document; feed the remaining bytes to parse the next document.
+// A top-level number ends at the next delimiter; when nothing follows it, call
+// finish() at the end of the input.
+// The JsonDocument must not be modified while a document is incomplete.
+class JsonIncrementalParser {
+ public:
+  JsonIncrementalParser(JsonDocument& doc,
+                        DeserializationOption::NestingLimit nestingLimit = {})
+      : doc_(doc),
+        allocator_(doc.allocator()),
+        resources_(detail::VariantAttorney::getResourceManager(doc)),
+        stringBuilder_(resources_),
+        nestingLimit_(nestingLimit) {}
+
+  JsonIncrementalParser(const JsonIncrementalParser&) = delete;
+  JsonIncrementalParser& operator=(const JsonIncrementalParser&) = delete;
+
+  ~JsonIncrementalParser() {
+    if (stack_)
+      allocator_->deallocate(stack_);
+  }
+
+  DeserializationError feed(const char* data, size_t n) {
+    const char* end = data + n;
+    const char* p = data;
+    DeserializationError::Code err = DeserializationError::IncompleteInput;
+
+    while (p < end && err == DeserializationError::IncompleteInput)
+      p = step(p, end, err);
+
+    consumed_ = size_t(p - data);
+    if (err != DeserializationError::IncompleteInput)
+      reset();
+    return err;
+  }
+
+  // Tells the parser that the input ended.
+  // Returns Ok if that completed a top-level number, EmptyInput if no document
+  // was started, or IncompleteInput if the document was truncated.
+  // The next byte starts a new document.
+  DeserializationError finish() {
+    DeserializationError::Code err;
+    if (depth_ == 0 && state_ == State::Number)
+      err = endNumber();
+    else if (depth_ == 0 && (state_ == State::Value ||
+                             (state_ == State::LineComment &&
+                              resumeState_ == State::Value)))
+      err = DeserializationError::EmptyInput;
+    else
+      err = DeserializationError::IncompleteInput;
+    consumed_ = 0;
+    reset();
+    return err;
+  }
+
+  // Returns the number of bytes of the last fragment that feed() used
+  size_t consumed() const {
+    return consumed_;
+  }
+
+  // Discards the incomplete document, so the next byte starts a new one
+  void reset() {
+    depth_ = 0;
+    state_ = State::Value;
+  }
+
+ private:
+  using VariantData = detail::VariantData;
+
+  enum class State : uint8_t {
+    Value,         // before a value
+    FirstElement,  // after '['
+    FirstKey,      // after '{'
+    Key,           // after ',' in an object
+    Colon,         // after a key
+    Separator,     // after a value in an array or an object
+    String,
+    Escape,
+    Hex,  // the four digits of "\u"
+    NonQuotedKey,
+    Number,
+    Keyword,
+    Slash,
+    BlockComment,
+    BlockCommentStar,
+    LineComment,
+  };
+
+  // Handles the character at p, or a run of characters that don't change the
+  // state; returns the next character to handle.
+  const char* step(const char* p, const char* end,
+                   DeserializationError::Code& err) {
+    using namespace detail;
+    char c = *p;
+
+    switch (state_) {
+      case State::Value:
+      case State::FirstElement:
+      case State::FirstKey:
+      case State::Key:
+      case State::Colon:
+      case State::Separator:
+        if (isSpace(c))
+          return InputScanner::skipSpaces(p, end);
+#if ARDUINOJSON_ENABLE_COMMENTS
+        if (c == '/') {
+          resumeState_ = state_;
+          state_ = State::Slash;
+          return p + 1;
+        }
+#endif
+        err = onToken(c);
+        return failed(err) ? p : p + tokenLength_;
+
+      case State::String: {
+        auto special = InputScanner::findSpecialChar(p, end, quote_);
+        stringBuilder_.append(p, size_t(special - p));
+        if (special == end)
+          return end;
+        c = *special;
+        if (c == quote_)
+          err = endString();
+        else if (c == '\\')
+          state_ = State::Escape;
+        else  // '\0'
+          err = DeserializationError::InvalidInput;
+        return failed(err) ? special : special + 1;
+      }
+
+      case State::Escape:
+        if (c == 'u') {
+#if ARDUINOJSON_DECODE_UNICODE
+          codeunit_ = 0;
+          hexDigits_ = 0;
+          state_ = State::Hex;
+#else
+          stringBuilder_.append('\\');
+          stringBuilder_.append('u');
+          state_ = State::String;
+#endif
+          return p + 1;
+        }
+        c = EscapeSequence::unescapeChar(c);
+        if (c == '\0') {
+          err = DeserializationError::InvalidInput;
+          return p;
+        }
+        stringBuilder_.append(c);
+        state_ = State::String;
+        return p + 1;
+
+#if ARDUINOJSON_DECODE_UNICODE
+      case State::Hex: {
+        uint8_t digit = decodeHex(c);
+        if (digit > 0x0F) {
+          err = DeserializationError::InvalidInput;
+          return p;
+        }
+        codeunit_ = uint16_t((codeunit_ << 4) | digit);
+        if (++hexDigits_ == 4) {
+          if (codepoint_.append(codeunit_))
+            Utf8::encodeCodepoint(codepoint_.value(), stringBuilder_);
+          state_ = State::String;
+        }
+        return p + 1;
+      }
+#endif
+
+      case State::NonQuotedKey:
+        if (canBeInNonQuotedString(c)) {
+          stringBuilder_.append(c);
+          return p + 1;
+        }
+        err = endString();
+        return p;  // c is handled in the Colon state
+
+      case State::Number:
+        if (canBeInNumber(c) && numberLength_ < sizeof(number_) - 1) {
+          number_[numberLength_++] = c;
+          return p + 1;
+        }
+        err = endNumber();
+        return p;  // c isn't part of the number
+
+      case State::Keyword:
+        if (c != keyword_[keywordLength_]) {
+          err = DeserializationError::InvalidInput;
+          return p;
+        }
+        if (keyword_[++keywordLength_] == 0) {
+          if (keyword_[0] != 'n')  // null is the value of a new slot
+            value_->setBoolean(keyword_[0] == 't');
+          err = endValue();
+        }
+        return p + 1;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+      case State::Slash:
+        if (c == '*')
+          state_ = State::BlockComment;
+        else if (c == '/')
+          state_ = State::LineComment;
+        else
+          err = DeserializationError::InvalidInput;
+        return failed(err) ? p : p + 1;
+
+      case State::BlockComment:
+        if (c == '*')
+          state_ = State::BlockCommentStar;
+        return p + 1;
+
+      case State::BlockCommentStar:
+        if (c == '/')
+          state_ = resumeState_;
+        else if (c != '*')
+          state_ = State::BlockComment;
+        return p + 1;
+
+      case State::LineComment:
+        if (c == '\n')
+          state_ = resumeState_;
+        return p + 1;
+#endif
+
+      default:
+        err = DeserializationError::InvalidInput;
+        return p;
+    }
+  }
+
+  // Handles a character that isn't a space, between the values
+  DeserializationError::Code onToken(char c) {
+    tokenLength_ = 1;
+
+    switch (state_) {
+      case State::FirstElement:
+        if (c == ']')
+          return endContainer();
+        state_ = State::Value;
+        return onToken(c);
+
+      case State::FirstKey:
+        if (c == '}')
+          return endContainer();
+        state_ = State::Key;
+        return onToken(c);
+
+      case State::Key:
+        stringBuilder_.startString();
+        if (c == '\"' || c == '\'') {
+          startString(c, true);
+        } else if (canBeInNonQuotedString(c)) {
+          state_ = State::NonQuotedKey;
+          tokenLength_ = 0;  // c is the first character of the key
+        } else {
+          return DeserializationError::InvalidInput;
+        }
+        return DeserializationError::IncompleteInput;
+
+      case State::Colon:
+        if (c != ':')
+          return DeserializationError::InvalidInput;
+        return addMember();
+
+      case State::Separator:
+        if (c == ',') {
+          state_ = top()->isArray() ? State::Value : State::Key;
+          return DeserializationError::IncompleteInput;
+        }
+        if (c == (top()->isArray() ? ']' : '}'))
+          return endContainer();
+        return DeserializationError::InvalidInput;
+
+      default:
+        return startValue(c);
+    }
+  }
+
+  DeserializationError::Code startValue(char c) {
+    using namespace detail;
+
+    if (depth_ == 0) {
+      value_ = VariantAttorney::getOrCreateData(doc_);
+      if (!value_)
+        return DeserializationError::NoMemory;
+      clearDestination(doc_);
+    } else if (top()->isArray()) {
+      value_ = top()->asArray()->addElement(resources_);
+      if (!value_)
+        return DeserializationError::NoMemory;
+    }  // else value_ is the member added after the colon
+
+    switch (c) {
+      case '[':
+      case '{':
+        if (depth_ >= nestingLimit_.value())
+          return DeserializationError::TooDeep;
+        if (!stack_) {
+          stack_ = static_cast<VariantData**>(allocator_->allocate(
+              nestingLimit_.value() * sizeof(VariantData*)));
+          if (!stack_)
+            return DeserializationError::NoMemory;
+        }
+        if (c == '[') {
+          value_->toArray();
+          state_ = State::FirstElement;
+        } else {
+          value_->toObject();
+          state_ = State::FirstKey;
+        }
+        stack_[depth_++] = value_;
+        return DeserializationError::IncompleteInput;
+
+      case '\"':
+      case '\'':
+        stringBuilder_.startString();
+        startString(c, false);
+        return DeserializationError::IncompleteInput;
+
+      case 't':
+      case 'f':
+      case 'n':
+        keyword_ = c == 't' ? "true" : c == 'f' ? "false" : "null";
+        keywordLength_ = 0;
+        state_ = State::Keyword;
+        tokenLength_ = 0;  // c is the first letter of the keyword
+        return DeserializationError::IncompleteInput;
+
+      default:
+        numberLength_ = 0;
+        state_ = State::Number;
+        tokenLength_ = 0;  // c is the first character of the number
+        return DeserializationError::IncompleteInput;
+    }
+  }
+
+  void startString(char quote, bool isKey) {
+    quote_ = quote;
+    isKey_ = isKey;
+#if ARDUINOJSON_DECODE_UNICODE
+    codepoint_ = detail::Utf16::Codepoint();
+#endif
+    state_ = State::String;
+  }
+
+  DeserializationError::Code endString() {
+    if (!stringBuilder_.isValid())
+      return DeserializationError::NoMemory;
+    if (isKey_) {
+      state_ = State::Colon;
+      return DeserializationError::IncompleteInput;
+    }
+    if (!value_->setString(stringBuilder_.save(), resources_))
+      return DeserializationError::NoMemory;
+    return endValue();
+  }
+
+  DeserializationError::Code addMember() {
+    using namespace detail;
+    JsonString key = stringBuilder_.str();
+    auto object = top()->asObject();
+    value_ = object->getMember(adaptString(key), resources_);
+    if (value_) {
+      value_->clear(resources_);
+    } else {
+      value_ = object->addMember(stringBuilder_.save(), resources_);
+      if (!value_)
+        return DeserializationError::NoMemory;
+    }
+    state_ = State::Value;
+    return DeserializationError::IncompleteInput;
+  }
+
+  DeserializationError::Code endNumber() {
+    using namespace detail;
+    number_[numberLength_] = 0;
+    auto number = parseNumber(number_);
+    bool ok;
+    switch (number.type()) {
+      case NumberType::UnsignedInteger:
+        ok = value_->setInteger(number.asUnsignedInteger(), resources_);
+        break;
+
+      case NumberType::SignedInteger:
+        ok = value_->setInteger(number.asSignedInteger(), resources_);
+        break;
+
+      case NumberType::Float:
+        ok = value_->setFloat(number.asFloat(), resources_);
+        break;
+
+#if ARDUINOJSON_USE_DOUBLE
+      case NumberType::Double:
+        ok = value_->setFloat(number.asDouble(), resources_);
+        break;
+#endif
+
+      default:
+        return DeserializationError::InvalidInput;
+    }
+    if (!ok)
+      return DeserializationError::NoMemory;
+    return endValue();
+  }
+
+  DeserializationError::Code endContainer() {
+    depth_--;
+    return endValue();
+  }
+
+  DeserializationError::Code endValue() {
+    if (depth_ == 0) {
+      detail::shrinkJsonDocument(doc_);
+      detail::VariantAttorney::getData(doc_)->buildIndex(resources_);
+      return DeserializationError::Ok;
+    }
+    state_ = State::Separator;
+    return DeserializationError::IncompleteInput;
+  }
+
+  detail::VariantData* top() const {
+    return stack_[depth_ - 1];
+  }
+
+  static bool failed(DeserializationError::Code err) {
+    return err != DeserializationError::IncompleteInput &&
+           err != DeserializationError::Ok;
+  }
+
+  static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  static bool isBetween(char c, char min, char max) {
+    return min <= c && c <= max;
+  }
+
+  // Same as JsonDeserializer
+  static bool canBeInNumber(char c) {
+    return isBetween(c, '0', '9') || c == '+' || c == '-' || c == '.' ||
+#if ARDUINOJSON_ENABLE_NAN || ARDUINOJSON_ENABLE_INFINITY
+           isBetween(c, 'A', 'Z') || isBetween(c, 'a', 'z');
+#else
+           c == 'e' || c == 'E';
+#endif
+  }
+
+  static bool canBeInNonQuotedString(char c) {
+    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
+           isBetween(c, 'A', 'Z');
+  }
+
+  static uint8_t decodeHex(char c) {
+    if (isBetween(c, '0', '9'))
+      return uint8_t(c - '0');
+    c = char(c & ~0x20);  // uppercase
+    if (isBetween(c, 'A', 'F'))
+      return uint8_t(c - 'A' + 10);
+    return 0xFF;
+  }
+
+  JsonDocument& doc_;
+  Allocator* allocator_;
+  detail::ResourceManager* resources_;
+  detail::StringBuilder stringBuilder_;
+  DeserializationOption::NestingLimit nestingLimit_;
+  VariantData** stack_ = nullptr;  // the open arrays and objects
+  VariantData* value_ = nullptr;   // where the current value goes
+  const char* keyword_ = nullptr;
+  size_t consumed_ = 0;
+#if ARDUINOJSON_DECODE_UNICODE
+  detail::Utf16::Codepoint codepoint_;
+  uint16_t codeunit_ = 0;
+  uint8_t hexDigits_ = 0;
+#endif
+  uint8_t depth_ = 0;
+  uint8_t numberLength_ = 0;
+  uint8_t keywordLength_ = 0;
+  uint8_t tokenLength_ = 0;  // 0 if the character starts a number or a word
+  char quote_ = 0;
+  bool isKey_ = false;
+  State state_ = State::Value;
+  State resumeState_ = State::Value;
+  char number_[64];
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
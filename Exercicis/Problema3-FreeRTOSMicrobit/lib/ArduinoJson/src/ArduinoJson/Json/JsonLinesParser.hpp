@@ -0,0 +1,198 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+
+#if ARDUINOJSON_ENABLE_STD_THREAD
+
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+
+#  if ARDUINOJSON_ENABLE_STD_STREAM
+#    include <istream>
+#    include <string>
+#  endif
+
+#  include <string.h>  // memchr
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses newline-delimited JSON (JSON Lines) on a pool of threads.
+// Each thread owns a JsonDocument, which it recycles from one line to the
+// next. The callback receives the index of the record (empty lines don't
+// count), the document, and the result of deserializeJson().
+// The calls to the callback never overlap, so it doesn't need a lock; with
+// ordered = true, they follow the order of the input.
+// The callback must not throw, and the allocator must be thread-safe.
+class JsonLinesParser {
+ public:
+  explicit JsonLinesParser(
+      size_t threadCount = 0,
+      Allocator* allocator = detail::DefaultAllocator::instance(),
+      DeserializationOption::NestingLimit nestingLimit = {})
+      : threadCount_(threadCount ? threadCount
+                                 : std::thread::hardware_concurrency()),
+        allocator_(allocator),
+        nestingLimit_(nestingLimit) {
+    if (threadCount_ == 0)  // hardware_concurrency() may return 0
+      threadCount_ = 1;
+  }
+
+  size_t threadCount() const {
+    return threadCount_;
+  }
+
+  // Parses the lines of a buffer, which stays untouched, so the strings are
+  // copied to the documents. Returns the number of records.
+  template <typename TCallback>
+  size_t parse(const char* input, size_t size, TCallback callback,
+               bool ordered = true) {
+    BufferSource source{input, input + size};
+    return run(source, callback, ordered);
+  }
+
+#  if ARDUINOJSON_ENABLE_STD_STREAM
+  // Parses the lines of a stream, which are read one at a time by the
+  // threads. Each line is parsed in place, in the buffer of the thread that
+  // read it, so the strings aren't copied. Returns the number of records.
+  template <typename TCallback>
+  size_t parse(std::istream& input, TCallback callback, bool ordered = true) {
+    StreamSource source{input};
+    return run(source, callback, ordered);
+  }
+#  endif
+
+ private:
+  struct Line {
+    const char* data;
+    size_t size;
+  };
+
+  struct BufferSource {
+    const char* cursor;
+    const char* end;
+
+    struct Buffer {};
+
+    // Must be called with the lock held
+    bool next(Line& line, Buffer&) {
+      while (cursor < end) {
+        auto eol = static_cast<const char*>(
+            memchr(cursor, '\n', size_t(end - cursor)));
+        if (!eol)
+          eol = end;
+        line = {cursor, size_t(eol - cursor)};
+        cursor = eol < end ? eol + 1 : end;
+        if (!isBlank(line))
+          return true;
+      }
+      return false;
+    }
+
+    static DeserializationError deserialize(
+        JsonDocument& doc, Line line, Buffer&,
+        DeserializationOption::NestingLimit nestingLimit) {
+      return deserializeJson(doc, line.data, line.size, nestingLimit);
+    }
+  };
+
+#  if ARDUINOJSON_ENABLE_STD_STREAM
+  struct StreamSource {
+    std::istream& stream;
+
+    using Buffer = std::string;
+
+    // Must be called with the lock held
+    bool next(Line& line, Buffer& buffer) {
+      while (std::getline(stream, buffer)) {
+        line = {buffer.data(), buffer.size()};
+        if (!isBlank(line))
+          return true;
+      }
+      return false;
+    }
+
+    // The line is in the buffer, which the thread keeps until the next line
+    static DeserializationError deserialize(
+        JsonDocument& doc, Line, Buffer& buffer,
+        DeserializationOption::NestingLimit nestingLimit) {
+      return deserializeJson(doc, inPlace(&buffer[0], buffer.size()),
+                             nestingLimit);
+    }
+  };
+#  endif
+
+  // The state shared by the threads of one parse()
+  template <typename TSource, typename TCallback>
+  struct Job {
+    TSource& source;
+    TCallback& callback;
+    bool ordered;
+    std::mutex inputMutex;
+    std::mutex outputMutex;
+    std::condition_variable turn;
+    size_t nextIndex;
+    size_t nextOutput;
+  };
+
+  static bool isBlank(Line line) {
+    return line.size == 0 || (line.size == 1 && line.data[0] == '\r');
+  }
+
+  template <typename TSource, typename TCallback>
+  size_t run(TSource& source, TCallback& callback, bool ordered) {
+    Job<TSource, TCallback> job{source, callback, ordered, {}, {}, {}, 0, 0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount_; i++)
+      threads.emplace_back([this, &job]() { work(job); });
+    work(job);  // the calling thread is one of the workers
+    for (auto& thread : threads)
+      thread.join();
+
+    return job.nextIndex;
+  }
+
+  template <typename TSource, typename TCallback>
+  void work(Job<TSource, TCallback>& job) {
+    JsonDocument doc(allocator_);
+    doc.recycle();  // keep the pools from one line to the next
+    typename TSource::Buffer buffer;
+
+    for (;;) {
+      Line line;
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(job.inputMutex);
+        if (!job.source.next(line, buffer))
+          return;
+        index = job.nextIndex++;
+      }
+
+      auto err = TSource::deserialize(doc, line, buffer, nestingLimit_);
+
+      std::unique_lock<std::mutex> lock(job.outputMutex);
+      if (job.ordered)
+        job.turn.wait(lock, [&]() { return job.nextOutput == index; });
+      job.callback(index, doc, err);
+      job.nextOutput++;
+      if (job.ordered) {
+        lock.unlock();
+        job.turn.notify_all();
+      }
+    }
+  }
+
+  size_t threadCount_;
+  Allocator* allocator_;
+  DeserializationOption::NestingLimit nestingLimit_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#endif
@@ -32,6 +32,12 @@ class Latch {
     return current_;
   }
 
+  // Gives direct access to the input, only between two characters
+  TReader& reader() {
+    ARDUINOJSON_ASSERT(!loaded_);
+    return reader_;
+  }
+
  private:
   void load() {
     ARDUINOJSON_ASSERT(!ended_);
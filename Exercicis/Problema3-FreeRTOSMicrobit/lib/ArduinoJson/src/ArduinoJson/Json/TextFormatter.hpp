@@ -8,13 +8,19 @@
 #include <string.h>  // for strlen
 
 #include <ArduinoJson/Json/EscapeSequence.hpp>
-#include <ArduinoJson/Numbers/FloatParts.hpp>
+#include <ArduinoJson/Json/InputScanner.hpp>
 #include <ArduinoJson/Numbers/JsonInteger.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/attributes.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 #include <ArduinoJson/Serialization/CountingDecorator.hpp>
 
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT
+#  include <ArduinoJson/Numbers/ShortestDecimal.hpp>
+#else
+#  include <ArduinoJson/Numbers/FloatParts.hpp>
+#endif
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 template <typename TWriter>
@@ -39,16 +45,25 @@ class TextFormatter {
   void writeString(const char* value) {
     ARDUINOJSON_ASSERT(value != NULL);
     writeRaw('\"');
-    while (*value)
+    for (;;) {
+      value = writeUnescaped(value, nullptr);
+      if (!*value)
+        break;
       writeChar(*value++);
+    }
     writeRaw('\"');
   }
 
   void writeString(const char* value, size_t n) {
     ARDUINOJSON_ASSERT(value != NULL);
+    const char* end = value + n;
     writeRaw('\"');
-    while (n--)
+    for (;;) {
+      value = writeUnescaped(value, end);
+      if (value == end)
+        break;
       writeChar(*value++);
+    }
     writeRaw('\"');
   }
 
@@ -66,10 +81,6 @@ class TextFormatter {
 
   template <typename T>
   void writeFloat(T value) {
-    writeFloat(JsonFloat(value), sizeof(T) >= 8 ? 9 : 6);
-  }
-
-  void writeFloat(JsonFloat value, int8_t decimalPlaces) {
     if (isnan(value))
       return writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
 
@@ -91,7 +102,15 @@ class TextFormatter {
     }
 #endif
 
-    auto parts = decomposeFloat(value, decimalPlaces);
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT
+    if (value == 0)
+      return writeRaw('0');
+
+    bool useExponent = value >= ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD ||
+                       value <= ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD;
+    writeDecimal(Grisu2::convert(value), useExponent);
+#else
+    auto parts = decomposeFloat(JsonFloat(value), sizeof(T) >= 8 ? 9 : 6);
 
     writeInteger(parts.integral);
     if (parts.decimalPlaces)
@@ -101,7 +120,58 @@ class TextFormatter {
       writeRaw('e');
       writeInteger(parts.exponent);
     }
+#endif
+  }
+
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT
+  void writeDecimal(const ShortestDecimal& number, bool useExponent) {
+    const char* digits = number.digits;
+    int length = number.length;
+    // position of the decimal point, relative to the first digit
+    int point = length + number.exponent;
+
+    if (useExponent) {
+      writeRaw(digits[0]);
+      if (length > 1) {
+        writeRaw('.');
+        writeRaw(digits + 1, digits + length);
+      }
+      writeRaw('e');
+      writeInteger(point - 1);
+    } else if (point <= 0) {  // 0.000ddd
+      writeRaw('0');
+      writeRaw('.');
+      for (int i = point; i < 0; i++)
+        writeRaw('0');
+      writeRaw(digits, digits + length);
+    } else if (point >= length) {  // ddd000
+      writeRaw(digits, digits + length);
+      for (int i = length; i < point; i++)
+        writeRaw('0');
+    } else {  // dd.ddd
+      writeRaw(digits, digits + point);
+      writeRaw('.');
+      writeRaw(digits + point, digits + length);
+    }
   }
+#else
+  void writeDecimals(uint32_t value, int8_t width) {
+    // buffer should be big enough for all digits and the dot
+    char buffer[16];
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+
+    // write the string in reverse order
+    while (width--) {
+      *--begin = char(value % 10 + '0');
+      value /= 10;
+    }
+    *--begin = '.';
+
+    // and dump it in the right order
+    writeRaw(begin, end);
+  }
+#endif
 
   template <typename T>
   enable_if_t<is_signed<T>::value> writeInteger(T value) {
@@ -132,21 +202,13 @@ class TextFormatter {
     writeRaw(begin, end);
   }
 
-  void writeDecimals(uint32_t value, int8_t width) {
-    // buffer should be big enough for all digits and the dot
-    char buffer[16];
-    char* end = buffer + sizeof(buffer);
-    char* begin = end;
-
-    // write the string in reverse order
-    while (width--) {
-      *--begin = char(value % 10 + '0');
-      value /= 10;
-    }
-    *--begin = '.';
-
-    // and dump it in the right order
-    writeRaw(begin, end);
+  // Writes the characters that need no escaping in one call, and returns the
+  // first one that does (or end)
+  const char* writeUnescaped(const char* begin, const char* end) {
+    const char* p = InputScanner::findCharToEscape(begin, end);
+    if (p != begin)
+      writeRaw(begin, p);
+    return p;
   }
 
   void writeRaw(const char* s) {
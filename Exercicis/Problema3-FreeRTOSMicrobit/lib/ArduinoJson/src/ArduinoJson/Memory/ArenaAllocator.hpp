@@ -0,0 +1,100 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Alignment.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// An allocator that carves the blocks out of a fixed buffer.
+// deallocate() only gives back the last block; call rewind() to reuse the
+// whole buffer once the documents using it are cleared.
+// Each block is preceded by its size, so that reallocate() knows how many
+// bytes to copy.
+class ArenaAllocator : public Allocator {
+ public:
+  ArenaAllocator(void* buffer, size_t capacity)
+      : begin_(static_cast<char*>(buffer)),
+        end_(begin_ + capacity),
+        top_(begin_) {}
+
+  virtual ~ArenaAllocator() {}
+
+  void* allocate(size_t size) override {
+    auto header = detail::addPadding(top_);
+    if (header > end_ || size_t(end_ - header) < headerSize ||
+        size > size_t(end_ - header) - headerSize)
+      return nullptr;
+    last_ = header + headerSize;
+    top_ = last_ + size;
+    setBlockSize(last_, size);
+    return last_;
+  }
+
+  void deallocate(void* ptr) override {
+    if (ptr && ptr == last_) {
+      top_ = last_ - headerSize;
+      last_ = nullptr;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    if (!ptr)
+      return allocate(newSize);
+
+    // the last block can grow or shrink in place
+    if (ptr == last_) {
+      if (newSize > size_t(end_ - last_))
+        return nullptr;
+      top_ = last_ + newSize;
+      setBlockSize(last_, newSize);
+      return ptr;
+    }
+
+    size_t oldSize = blockSize(ptr);
+    auto p = allocate(newSize);
+    if (p)
+      memcpy(p, ptr, newSize < oldSize ? newSize : oldSize);
+    return p;
+  }
+
+  // Makes the whole buffer available again, in constant time
+  void rewind() {
+    top_ = begin_;
+    last_ = nullptr;
+  }
+
+  // Returns the number of bytes in use, including the padding
+  size_t size() const {
+    return size_t(top_ - begin_);
+  }
+
+  size_t capacity() const {
+    return size_t(end_ - begin_);
+  }
+
+ private:
+  static const size_t headerSize = detail::AddPadding<sizeof(size_t)>::value;
+
+  static void setBlockSize(char* block, size_t size) {
+    memcpy(block - headerSize, &size, sizeof(size));
+  }
+
+  static size_t blockSize(void* block) {
+    size_t size;
+    memcpy(&size, static_cast<char*>(block) - headerSize, sizeof(size));
+    return size;
+  }
+
+  char* begin_;
+  char* end_;
+  char* top_;
+  char* last_ = nullptr;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -28,7 +28,7 @@ class MemoryPoolList {
   MemoryPoolList() = default;
 
   ~MemoryPoolList() {
-    ARDUINOJSON_ASSERT(count_ == 0);
+    ARDUINOJSON_ASSERT(allocated_ == 0);
   }
 
   friend void swap(MemoryPoolList& a, MemoryPoolList& b) {
@@ -42,13 +42,13 @@ class MemoryPoolList {
         swap_(a.preallocatedPools_[i], b.preallocatedPools_[i]);
     } else if (bUsedPreallocated) {
       // only b => copy b's preallocated pools and give him a's pointer
-      for (PoolCount i = 0; i < b.count_; i++)
+      for (PoolCount i = 0; i < b.allocated_; i++)
         a.preallocatedPools_[i] = b.preallocatedPools_[i];
       b.pools_ = a.pools_;
       a.pools_ = a.preallocatedPools_;
     } else if (aUsedPreallocated) {
       // only a => copy a's preallocated pools and give him b's pointer
-      for (PoolCount i = 0; i < a.count_; i++)
+      for (PoolCount i = 0; i < a.allocated_; i++)
         b.preallocatedPools_[i] = a.preallocatedPools_[i];
       a.pools_ = b.pools_;
       b.pools_ = b.preallocatedPools_;
@@ -58,12 +58,13 @@ class MemoryPoolList {
     }
 
     swap_(a.count_, b.count_);
+    swap_(a.allocated_, b.allocated_);
     swap_(a.capacity_, b.capacity_);
     swap_(a.freeList_, b.freeList_);
   }
 
   MemoryPoolList& operator=(MemoryPoolList&& src) {
-    ARDUINOJSON_ASSERT(count_ == 0);
+    ARDUINOJSON_ASSERT(allocated_ == 0);
     if (src.pools_ == src.preallocatedPools_) {
       memcpy(preallocatedPools_, src.preallocatedPools_,
              sizeof(preallocatedPools_));
@@ -73,8 +74,10 @@ class MemoryPoolList {
       src.pools_ = nullptr;
     }
     count_ = src.count_;
+    allocated_ = src.allocated_;
     capacity_ = src.capacity_;
     src.count_ = 0;
+    src.allocated_ = 0;
     src.capacity_ = 0;
     return *this;
   }
@@ -115,9 +118,10 @@ class MemoryPoolList {
   }
 
   void clear(Allocator* allocator) {
-    for (PoolCount i = 0; i < count_; i++)
+    for (PoolCount i = 0; i < allocated_; i++)
       pools_[i].destroy(allocator);
     count_ = 0;
+    allocated_ = 0;
     freeList_ = NULL_SLOT;
     if (pools_ != preallocatedPools_) {
       allocator->deallocate(pools_);
@@ -126,6 +130,12 @@ class MemoryPoolList {
     }
   }
 
+  // Empties the pools but keeps them for the next allocations
+  void recycle() {
+    count_ = 0;
+    freeList_ = NULL_SLOT;
+  }
+
   SlotCount usage() const {
     SlotCount total = 0;
     for (PoolCount i = 0; i < count_; i++)
@@ -137,7 +147,23 @@ class MemoryPoolList {
     return Pool::slotsToBytes(usage());
   }
 
+  PoolCount count() const {
+    return count_;
+  }
+
+  // Walks the free list
+  size_t freeCount() const {
+    size_t n = 0;
+    for (auto id = freeList_; id != NULL_SLOT;
+         id = reinterpret_cast<FreeSlot*>(getSlot(id))->next)
+      n++;
+    return n;
+  }
+
   void shrinkToFit(Allocator* allocator) {
+    for (PoolCount i = count_; i < allocated_; i++)
+      pools_[i].destroy(allocator);
+    allocated_ = count_;
     if (count_ > 0)
       pools_[count_ - 1].shrinkToFit(allocator);
     if (pools_ != preallocatedPools_ && count_ != capacity_) {
@@ -168,9 +194,15 @@ class MemoryPoolList {
   }
 
   Pool* addPool(Allocator* allocator) {
+    if (count_ < allocated_) {  // reuse a recycled pool
+      auto pool = &pools_[count_++];
+      pool->clear();
+      return pool;
+    }
     if (count_ == capacity_ && !increaseCapacity(allocator))
       return nullptr;
     auto pool = &pools_[count_++];
+    allocated_ = count_;
     SlotCount poolCapacity = ARDUINOJSON_POOL_CAPACITY;
     if (count_ == maxPools)  // last pool is smaller because of NULL_SLOT
       poolCapacity--;
@@ -203,6 +235,7 @@ class MemoryPoolList {
   Pool preallocatedPools_[ARDUINOJSON_INITIAL_POOL_COUNT];
   Pool* pools_ = preallocatedPools_;
   PoolCount count_ = 0;
+  PoolCount allocated_ = 0;  // count_ plus the recycled pools
   PoolCount capacity_ = ARDUINOJSON_INITIAL_POOL_COUNT;
   SlotId freeList_ = NULL_SLOT;
 
@@ -5,8 +5,15 @@
 #pragma once
 
 #include <ArduinoJson/Memory/Allocator.hpp>
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+#  include <ArduinoJson/Array/ArrayIndex.hpp>
+#endif
 #include <ArduinoJson/Memory/MemoryPoolList.hpp>
+#include <ArduinoJson/Memory/ResourceStats.hpp>
 #include <ArduinoJson/Memory/StringPool.hpp>
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+#  include <ArduinoJson/Object/ObjectIndex.hpp>
+#endif
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 #include <ArduinoJson/Strings/StringAdapters.hpp>
@@ -29,11 +36,26 @@ class ResourceManager {
   constexpr static size_t slotSize = sizeof(SlotData);
 
   ResourceManager(Allocator* allocator = DefaultAllocator::instance())
-      : allocator_(allocator), overflowed_(false) {}
+      :
+#if ARDUINOJSON_ENABLE_STATS
+        counter_(allocator),
+        allocator_(&counter_),
+#else
+        allocator_(allocator),
+#endif
+        overflowed_(false),
+        recycling_(false),
+        frozen_(false) {}
 
   ~ResourceManager() {
     stringPool_.clear(allocator_);
     variantPools_.clear(allocator_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    objectIndex_.clear(allocator_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    arrayIndex_.clear(allocator_);
+#endif
   }
 
   ResourceManager(const ResourceManager&) = delete;
@@ -42,14 +64,42 @@ class ResourceManager {
   friend void swap(ResourceManager& a, ResourceManager& b) {
     swap(a.stringPool_, b.stringPool_);
     swap(a.variantPools_, b.variantPools_);
+#if ARDUINOJSON_ENABLE_STATS
+    swap(a.counter_, b.counter_);  // allocator_ points to counter_
+    swap_(a.stats_, b.stats_);
+#else
     swap_(a.allocator_, b.allocator_);
+#endif
     swap_(a.overflowed_, b.overflowed_);
+    swap_(a.recycling_, b.recycling_);
+    swap_(a.frozen_, b.frozen_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    // the root variants are swapped separately
+    swap(a.objectIndex_, b.objectIndex_);
+    a.objectIndex_.reset();
+    b.objectIndex_.reset();
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    swap(a.arrayIndex_, b.arrayIndex_);
+    a.arrayIndex_.reset();
+    b.arrayIndex_.reset();
+#endif
   }
 
+  // The allocator for the pools, the strings, and the indexes
   Allocator* allocator() const {
     return allocator_;
   }
 
+  // The allocator passed to the constructor
+  Allocator* sourceAllocator() const {
+#if ARDUINOJSON_ENABLE_STATS
+    return counter_.upstream();
+#else
+    return allocator_;
+#endif
+  }
+
   size_t size() const {
     return variantPools_.size() + stringPool_.size();
   }
@@ -58,6 +108,29 @@ class ResourceManager {
     return overflowed_;
   }
 
+  // True between recycle() and the next clear() or shrinkToFit()
+  bool recycling() const {
+    return recycling_;
+  }
+
+  // True between freeze() and the next allocation or release of a slot
+  bool frozen() const {
+    return frozen_;
+  }
+
+  // Moves the slots to new pools, in document order, so the children of each
+  // collection are in consecutive slots, and releases the old pools.
+  // Returns false if the new pools couldn't be allocated; the tree is intact.
+  bool compact(VariantData* root);
+
+  // Like compact(), but also sets the frozen flag
+  bool freeze(VariantData* root) {
+    if (!compact(root))
+      return false;
+    frozen_ = true;
+    return true;
+  }
+
   Slot<VariantData> allocVariant();
   void freeVariant(Slot<VariantData> slot);
   VariantData* getVariant(SlotId id) const;
@@ -75,31 +148,43 @@ class ResourceManager {
 
     auto node = stringPool_.add(str, allocator_);
     if (!node)
-      overflowed_ = true;
+      overflow(OverflowReason::String);
+#if ARDUINOJSON_ENABLE_STATS
+    stats_.stringLookups++;
+    if (node && node->references > 1)
+      stats_.stringHits++;
+#endif
 
     return node;
   }
 
   void saveString(StringNode* node) {
-    stringPool_.add(node);
+    stringPool_.add(node, allocator_);
   }
 
+  // The caller adds a reference to the returned node, or saves a new one
   template <typename TAdaptedString>
   StringNode* getString(const TAdaptedString& str) const {
-    return stringPool_.get(str);
+    auto node = stringPool_.get(str);
+#if ARDUINOJSON_ENABLE_STATS
+    stats_.stringLookups++;
+    if (node)
+      stats_.stringHits++;
+#endif
+    return node;
   }
 
   StringNode* createString(size_t length) {
     auto node = StringNode::create(length, allocator_);
     if (!node)
-      overflowed_ = true;
+      overflow(OverflowReason::String);
     return node;
   }
 
   StringNode* resizeString(StringNode* node, size_t length) {
     node = StringNode::resize(node, length, allocator_);
     if (!node)
-      overflowed_ = true;
+      overflow(OverflowReason::String);
     return node;
   }
 
@@ -114,18 +199,134 @@ class ResourceManager {
   void clear() {
     variantPools_.clear(allocator_);
     overflowed_ = false;
+    recycling_ = false;
+    frozen_ = false;
+#if ARDUINOJSON_ENABLE_STATS
+    stats_.slots = 0;
+#endif
     stringPool_.clear(allocator_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    objectIndex_.clear(allocator_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    arrayIndex_.clear(allocator_);
+#endif
+  }
+
+  // Like clear(), but keeps the memory pools and the index tables
+  void recycle() {
+    variantPools_.recycle();
+    overflowed_ = false;
+    recycling_ = true;
+    frozen_ = false;
+#if ARDUINOJSON_ENABLE_STATS
+    stats_.slots = 0;
+#endif
+    stringPool_.clear(allocator_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    objectIndex_.reset();
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    arrayIndex_.reset();
+#endif
   }
 
   void shrinkToFit() {
+    recycling_ = false;
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    objectIndex_.clear(allocator_);  // slots might move
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    arrayIndex_.clear(allocator_);  // slots might move
+#endif
     variantPools_.shrinkToFit(allocator_);
   }
 
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  ObjectIndex& objectIndex() {
+    return objectIndex_;
+  }
+
+  // Const lookups only read the index, so they can run concurrently
+  const ObjectIndex& objectIndex() const {
+    return objectIndex_;
+  }
+#endif
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  ArrayIndex& arrayIndex() {
+    return arrayIndex_;
+  }
+
+  // Const lookups only read the index, so they can run concurrently
+  const ArrayIndex& arrayIndex() const {
+    return arrayIndex_;
+  }
+#endif
+
+  // Returns zeros unless ARDUINOJSON_ENABLE_STATS is 1
+  ResourceStats stats() const {
+    ResourceStats result = {};
+#if ARDUINOJSON_ENABLE_STATS
+    result = stats_;
+    counter_.getStats(result);
+    result.pools = variantPools_.count();
+    result.freeSlots = variantPools_.freeCount();
+    result.stringBytes = stringPool_.size();
+#endif
+    return result;
+  }
+
+  // Restarts the counters, but not the current usage
+  void resetStats() {
+#if ARDUINOJSON_ENABLE_STATS
+    counter_.resetStats();
+    auto slots = stats_.slots;
+    stats_ = {};
+    stats_.slots = slots;
+    stats_.peakSlots = slots;
+#endif
+  }
+
  private:
+  bool moveSlots(VariantData* var, MemoryPoolList<SlotData>& pools);
+
+  void overflow(OverflowReason reason) {
+    overflowed_ = true;
+#if ARDUINOJSON_ENABLE_STATS
+    stats_.overflows++;
+    stats_.lastOverflow = reason;
+#else
+    (void)reason;
+#endif
+  }
+
+#if ARDUINOJSON_ENABLE_STATS
+  // Slot counts; the other members are filled by stats()
+  void onSlotAllocated() {
+    if (++stats_.slots > stats_.peakSlots)
+      stats_.peakSlots = stats_.slots;
+  }
+
+  void onSlotReleased() {
+    stats_.slots--;
+  }
+
+  CountingAllocator counter_;
+  mutable ResourceStats stats_ = {};  // updated by getString()
+#endif
   Allocator* allocator_;
   bool overflowed_;
+  bool recycling_;
+  bool frozen_;
   StringPool stringPool_;
   MemoryPoolList<SlotData> variantPools_;
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  ObjectIndex objectIndex_;
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  ArrayIndex arrayIndex_;
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
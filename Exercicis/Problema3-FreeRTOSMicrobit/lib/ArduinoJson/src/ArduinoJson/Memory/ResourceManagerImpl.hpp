@@ -12,17 +12,25 @@
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 inline Slot<VariantData> ResourceManager::allocVariant() {
+  frozen_ = false;
   auto p = variantPools_.allocSlot(allocator_);
   if (!p) {
-    overflowed_ = true;
+    overflow(OverflowReason::Slot);
     return {};
   }
+#if ARDUINOJSON_ENABLE_STATS
+  onSlotAllocated();
+#endif
   return {new (&p->variant) VariantData, p.id()};
 }
 
 inline void ResourceManager::freeVariant(Slot<VariantData> variant) {
+  frozen_ = false;
   variant->clear(this);
   variantPools_.freeSlot({alias_cast<SlotData*>(variant.ptr()), variant.id()});
+#if ARDUINOJSON_ENABLE_STATS
+  onSlotReleased();
+#endif
 }
 
 inline VariantData* ResourceManager::getVariant(SlotId id) const {
@@ -31,17 +39,25 @@ inline VariantData* ResourceManager::getVariant(SlotId id) const {
 
 #if ARDUINOJSON_USE_EXTENSIONS
 inline Slot<VariantExtension> ResourceManager::allocExtension() {
+  frozen_ = false;
   auto p = variantPools_.allocSlot(allocator_);
   if (!p) {
-    overflowed_ = true;
+    overflow(OverflowReason::Slot);
     return {};
   }
+#if ARDUINOJSON_ENABLE_STATS
+  onSlotAllocated();
+#endif
   return {&p->extension, p.id()};
 }
 
 inline void ResourceManager::freeExtension(SlotId id) {
+  frozen_ = false;
   auto p = getExtension(id);
   variantPools_.freeSlot({reinterpret_cast<SlotData*>(p), id});
+#if ARDUINOJSON_ENABLE_STATS
+  onSlotReleased();
+#endif
 }
 
 inline VariantExtension* ResourceManager::getExtension(SlotId id) const {
@@ -49,4 +65,71 @@ inline VariantExtension* ResourceManager::getExtension(SlotId id) const {
 }
 #endif
 
+inline bool ResourceManager::compact(VariantData* root) {
+  MemoryPoolList<SlotData> pools;
+  VariantData newRoot = *root;
+  if (!moveSlots(&newRoot, pools)) {
+    pools.clear(allocator_);
+    return false;
+  }
+
+  *root = newRoot;
+  swap(variantPools_, pools);
+  pools.clear(allocator_);
+  variantPools_.shrinkToFit(allocator_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  objectIndex_.clear(allocator_);  // slots moved
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  arrayIndex_.clear(allocator_);  // slots moved
+#endif
+  return true;
+}
+
+// Copies the extension and the children of var to the new pools.
+// The children are copied before the grandchildren, so they get consecutive
+// slots.
+inline bool ResourceManager::moveSlots(VariantData* var,
+                                       MemoryPoolList<SlotData>& pools) {
+#if ARDUINOJSON_USE_EXTENSIONS
+  auto extension = var->getExtension(this);
+  if (extension) {
+    auto p = pools.allocSlot(allocator_);
+    if (!p)
+      return false;
+    p->extension = *extension;
+    var->moveExtension(p.id());
+  }
+#endif
+
+  auto collection = var->asCollection();
+  if (!collection)
+    return true;
+
+  SlotId head = NULL_SLOT, tail = NULL_SLOT;
+  VariantData* last = nullptr;
+  for (auto id = collection->head(); id != NULL_SLOT;) {
+    auto p = pools.allocSlot(allocator_);
+    if (!p)
+      return false;
+    auto child = new (&p->variant) VariantData(*getVariant(id));
+    id = child->next();
+    if (last)
+      last->setNext(p.id());
+    else
+      head = p.id();
+    last = child;
+    tail = p.id();
+  }
+  collection->moveChildren(head, tail);
+
+  for (auto id = head; id != NULL_SLOT;) {
+    auto child = &pools.getSlot(id)->variant;
+    if (!moveSlots(child, pools))
+      return false;
+    id = child->next();
+  }
+  return true;
+}
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
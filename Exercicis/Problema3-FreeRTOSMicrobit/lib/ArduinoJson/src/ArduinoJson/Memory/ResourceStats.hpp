@@ -0,0 +1,123 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Polyfills/integer.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Why the ResourceManager last failed to allocate
+enum class OverflowReason : uint8_t {
+  None,
+  Slot,    // a variant or a 64-bit value
+  String,  // a string or a string buffer
+};
+
+// A snapshot of the counters returned by JsonDocument::stats().
+// They are only collected when ARDUINOJSON_ENABLE_STATS is 1.
+struct ResourceStats {
+  // Calls that reached the allocator
+  size_t allocations;
+  size_t reallocations;
+  size_t deallocations;
+  size_t failedAllocations;  // failed allocate() and reallocate()
+
+  // Variant and extension slots
+  size_t slots;
+  size_t peakSlots;
+  size_t pools;
+  size_t freeSlots;  // length of the free list
+
+  // String pool
+  size_t stringBytes;
+  size_t stringLookups;  // strings stored, new or not
+  size_t stringHits;     // strings that were already in the pool
+
+  // overflowed() events
+  size_t overflows;
+  OverflowReason lastOverflow;
+
+  float stringHitRatio() const {
+    return stringLookups ? float(stringHits) / float(stringLookups) : 0;
+  }
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#if ARDUINOJSON_ENABLE_STATS
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Sits between the ResourceManager and the user's allocator to count the
+// calls
+class CountingAllocator : public Allocator {
+ public:
+  CountingAllocator(Allocator* upstream) : upstream_(upstream) {}
+
+  virtual ~CountingAllocator() {}
+
+  friend void swap(CountingAllocator& a, CountingAllocator& b) {
+    swap_(a.upstream_, b.upstream_);
+    swap_(a.allocations_, b.allocations_);
+    swap_(a.reallocations_, b.reallocations_);
+    swap_(a.deallocations_, b.deallocations_);
+    swap_(a.failures_, b.failures_);
+  }
+
+  void* allocate(size_t size) override {
+    auto p = upstream_->allocate(size);
+    if (p)
+      allocations_++;
+    else
+      failures_++;
+    return p;
+  }
+
+  void deallocate(void* ptr) override {
+    if (ptr)
+      deallocations_++;
+    upstream_->deallocate(ptr);
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    auto p = upstream_->reallocate(ptr, newSize);
+    if (p)
+      reallocations_++;
+    else
+      failures_++;
+    return p;
+  }
+
+  Allocator* upstream() const {
+    return upstream_;
+  }
+
+  void getStats(ResourceStats& stats) const {
+    stats.allocations = allocations_;
+    stats.reallocations = reallocations_;
+    stats.deallocations = deallocations_;
+    stats.failedAllocations = failures_;
+  }
+
+  void resetStats() {
+    allocations_ = 0;
+    reallocations_ = 0;
+    deallocations_ = 0;
+    failures_ = 0;
+  }
+
+ private:
+  Allocator* upstream_;
+  size_t allocations_ = 0;
+  size_t reallocations_ = 0;
+  size_t deallocations_ = 0;
+  size_t failures_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+#endif
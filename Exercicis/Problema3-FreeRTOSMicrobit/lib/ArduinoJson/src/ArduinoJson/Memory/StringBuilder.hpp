@@ -6,6 +6,8 @@
 
 #include <ArduinoJson/Memory/ResourceManager.hpp>
 
+#include <string.h>  // memcpy
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 class StringBuilder {
@@ -46,8 +48,19 @@ class StringBuilder {
   }
 
   void append(const char* s, size_t n) {
-    while (n-- > 0)  // TODO: memcpy
-      append(*s++);
+    while (node_ && n > 0) {
+      if (size_ == node_->length)
+        node_ = resources_->resizeString(node_, size_ * 2U + 1);
+      if (!node_)
+        break;
+      size_t chunk = node_->length - size_;
+      if (chunk > n)
+        chunk = n;
+      memcpy(node_->data + size_, s, chunk);
+      size_ += chunk;
+      s += chunk;
+      n -= chunk;
+    }
   }
 
   void append(char c) {
@@ -6,6 +6,9 @@
 
 #include <ArduinoJson/Memory/Allocator.hpp>
 #include <ArduinoJson/Memory/StringNode.hpp>
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+#  include <ArduinoJson/Memory/StringPoolIndex.hpp>
+#endif
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 #include <ArduinoJson/Strings/StringAdapters.hpp>
@@ -24,6 +27,10 @@ class StringPool {
 
   friend void swap(StringPool& a, StringPool& b) {
     swap_(a.strings_, b.strings_);
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+    swap_(a.count_, b.count_);
+    swap(a.index_, b.index_);
+#endif
   }
 
   void clear(Allocator* allocator) {
@@ -32,6 +39,10 @@ class StringPool {
       strings_ = node->next;
       StringNode::destroy(node, allocator);
     }
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+    count_ = 0;
+    index_.clear(allocator);
+#endif
   }
 
   size_t size() const {
@@ -59,18 +70,31 @@ class StringPool {
 
     stringGetChars(str, node->data, n);
     node->data[n] = 0;  // force NUL terminator
-    add(node);
+    add(node, allocator);
     return node;
   }
 
-  void add(StringNode* node) {
+  void add(StringNode* node, Allocator* allocator) {
     ARDUINOJSON_ASSERT(node != nullptr);
     node->next = strings_;
     strings_ = node;
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+    count_++;
+    if (index_.isActive() && index_.hasRoomFor(count_))
+      index_.insert(node);
+    else if (count_ >= StringPoolIndex::minStrings)
+      index_.rebuild(strings_, count_, allocator);  // falls back to linear
+#else
+    (void)allocator;
+#endif
   }
 
   template <typename TAdaptedString>
   StringNode* get(const TAdaptedString& str) const {
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+    if (index_.isActive())
+      return index_.find(str);
+#endif
     for (auto node = strings_; node; node = node->next) {
       if (stringEquals(str, adaptString(node->data, node->length)))
         return node;
@@ -79,6 +103,20 @@ class StringPool {
   }
 
   void dereference(const char* s, Allocator* allocator) {
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+    if (index_.isActive()) {
+      // s always comes from a StringNode of this pool
+      auto node = reinterpret_cast<StringNode*>(
+          const_cast<char*>(s) - offsetof(StringNode, data));
+      ARDUINOJSON_ASSERT(index_.find(adaptString(s, node->length)) == node);
+      if (--node->references == 0) {
+        index_.remove(node);
+        unlink(node);
+        StringNode::destroy(node, allocator);
+      }
+      return;
+    }
+#endif
     StringNode* prev = nullptr;
     for (auto node = strings_; node; node = node->next) {
       if (node->data == s) {
@@ -87,6 +125,9 @@ class StringPool {
             prev->next = node->next;
           else
             strings_ = node->next;
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+          count_--;
+#endif
           StringNode::destroy(node, allocator);
         }
         return;
@@ -96,6 +137,18 @@ class StringPool {
   }
 
  private:
+#if ARDUINOJSON_ENABLE_STRING_POOL_INDEX
+  void unlink(StringNode* node) {
+    StringNode** p = &strings_;
+    while (*p != node)
+      p = &(*p)->next;
+    *p = node->next;
+    count_--;
+  }
+
+  size_t count_ = 0;
+  StringPoolIndex index_;
+#endif
   StringNode* strings_ = nullptr;
 };
 
@@ -0,0 +1,123 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/StringNode.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <string.h>  // memset
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Open-addressing hash table (linear probing) over the nodes of a StringPool.
+// The table only stores pointers: the hashes are recomputed from the strings
+// when the table grows, so StringNode keeps the same layout.
+class StringPoolIndex {
+ public:
+  // Below this number of strings, a linear search is faster
+  static constexpr size_t minStrings = 16;
+
+  StringPoolIndex() = default;
+  StringPoolIndex(const StringPoolIndex&) = delete;
+  void operator=(const StringPoolIndex&) = delete;
+
+  ~StringPoolIndex() {
+    ARDUINOJSON_ASSERT(table_ == nullptr);
+  }
+
+  friend void swap(StringPoolIndex& a, StringPoolIndex& b) {
+    swap_(a.table_, b.table_);
+    swap_(a.capacity_, b.capacity_);
+  }
+
+  bool isActive() const {
+    return table_ != nullptr;
+  }
+
+  template <typename TAdaptedString>
+  StringNode* find(const TAdaptedString& str) const {
+    ARDUINOJSON_ASSERT(isActive());
+    size_t mask = capacity_ - 1;
+    for (size_t i = stringHash(str) & mask;; i = (i + 1) & mask) {
+      auto node = table_[i];
+      if (!node || stringEquals(str, adaptString(node->data, node->length)))
+        return node;
+    }
+  }
+
+  // Rebuilds the table for the given list of nodes.
+  // Returns false (and leaves the index inactive) if the allocation fails.
+  bool rebuild(StringNode* nodes, size_t count, Allocator* allocator) {
+    size_t capacity = 2 * minStrings;
+    while (capacity < 2 * count)  // keep the load factor under 50%
+      capacity *= 2;
+    clear(allocator);
+    auto table = reinterpret_cast<StringNode**>(
+        allocator->allocate(capacity * sizeof(StringNode*)));
+    if (!table)
+      return false;
+    memset(table, 0, capacity * sizeof(StringNode*));
+    table_ = table;
+    capacity_ = capacity;
+    for (auto node = nodes; node; node = node->next)
+      insert(node);
+    return true;
+  }
+
+  // Returns false if the table must be rebuilt to accommodate count strings
+  bool hasRoomFor(size_t count) const {
+    return 4 * count <= 3 * capacity_;
+  }
+
+  void insert(StringNode* node) {
+    ARDUINOJSON_ASSERT(isActive());
+    size_t mask = capacity_ - 1;
+    size_t i = hashOf(node) & mask;
+    while (table_[i])
+      i = (i + 1) & mask;
+    table_[i] = node;
+  }
+
+  void remove(StringNode* node) {
+    ARDUINOJSON_ASSERT(isActive());
+    size_t mask = capacity_ - 1;
+    size_t i = hashOf(node) & mask;
+    while (table_[i] != node) {
+      ARDUINOJSON_ASSERT(table_[i] != nullptr);
+      i = (i + 1) & mask;
+    }
+
+    // backward-shift deletion: no tombstones needed
+    for (size_t j = (i + 1) & mask; table_[j]; j = (j + 1) & mask) {
+      size_t home = hashOf(table_[j]) & mask;
+      // move table_[j] to the hole if the hole lies between home and j
+      if (((j - home) & mask) >= ((j - i) & mask)) {
+        table_[i] = table_[j];
+        i = j;
+      }
+    }
+    table_[i] = nullptr;
+  }
+
+  void clear(Allocator* allocator) {
+    if (table_)
+      allocator->deallocate(table_);
+    table_ = nullptr;
+    capacity_ = 0;
+  }
+
+ private:
+  static uint32_t hashOf(const StringNode* node) {
+    return stringHash(adaptString(node->data, node->length));
+  }
+
+  StringNode** table_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
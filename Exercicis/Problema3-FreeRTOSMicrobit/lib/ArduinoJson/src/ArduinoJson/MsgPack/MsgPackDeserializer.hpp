@@ -12,10 +12,15 @@
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 #include <ArduinoJson/Variant/VariantData.hpp>
 
+#include <string.h>  // memchr, memmove
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 template <typename TReader>
 class MsgPackDeserializer {
+  // in-place inputs keep their strings in the input buffer
+  using in_place = IsInPlaceReader<TReader>;
+
  public:
   MsgPackDeserializer(ResourceManager* resources, TReader reader)
       : resources_(resources),
@@ -31,6 +36,14 @@ class MsgPackDeserializer {
     return foundSomething_ ? err : DeserializationError::EmptyInput;
   }
 
+  template <typename THandler>
+  DeserializationError parseEvents(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+    err = emitVariant(handler, nestingLimit);
+    return foundSomething_ ? err : DeserializationError::EmptyInput;
+  }
+
  private:
   template <typename TFilter>
   DeserializationError::Code parseVariant(
@@ -95,9 +108,206 @@ class MsgPackDeserializer {
       return DeserializationError::Ok;
     }
 
-    uint8_t sizeBytes = 0;
-    size_t size = 0;
-    bool isExtension = code >= 0xc7 && code <= 0xc9;
+    uint8_t sizeBytes;
+    size_t size;
+    bool isExtension;
+    err = readSize(header, sizeBytes, size, isExtension);
+    if (err)
+      return err;
+
+    // array 16, 32 and fixarray
+    if (code == 0xdc || code == 0xdd || (code & 0xf0) == 0x90)
+      return readArray(variant, size, filter, nestingLimit);
+
+    // map 16, 32 and fixmap
+    if (code == 0xde || code == 0xdf || (code & 0xf0) == 0x80)
+      return readObject(variant, size, filter, nestingLimit);
+
+    // str 8, 16, 32 and fixstr
+    if (code == 0xd9 || code == 0xda || code == 0xdb || (code & 0xe0) == 0xa0) {
+      if (allowValue)
+        return readString(variant, size);
+      else
+        return skipBytes(size);
+    }
+
+    if (isExtension)
+      size++;  // to include the type
+
+    if (allowValue)
+      return readRawString(variant, header, uint8_t(1 + sizeBytes), size);
+    else
+      return skipBytes(size);
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitVariant(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    uint8_t header[5];
+    err = readBytes(header, 1);
+    if (err)
+      return err;
+
+    const uint8_t& code = header[0];
+
+    foundSomething_ = true;
+
+    if (code >= 0xcc && code <= 0xd3) {
+      auto width = uint8_t(1U << ((code - 0xcc) % 4));
+      return emitInteger(handler, width, code >= 0xd0);
+    }
+
+    switch (code) {
+      case 0xc0:
+        handler.onNull();
+        return DeserializationError::Ok;
+
+      case 0xc1:
+        return DeserializationError::InvalidInput;
+
+      case 0xc2:
+      case 0xc3:
+        handler.onBoolean(code == 0xc3);
+        return DeserializationError::Ok;
+
+      case 0xca: {
+        float value;
+        err = readFloat(value);
+        if (!err)
+          handler.onFloat(JsonFloat(value));
+        return err;
+      }
+
+      case 0xcb: {
+        double value;
+        err = readDouble(value);
+        if (!err)
+          handler.onFloat(JsonFloat(value));
+        return err;
+      }
+    }
+
+    if (code <= 0x7f || code >= 0xe0) {  // fixint
+      handler.onInteger(static_cast<int8_t>(code));
+      return DeserializationError::Ok;
+    }
+
+    uint8_t sizeBytes;
+    size_t size;
+    bool isExtension;
+    err = readSize(header, sizeBytes, size, isExtension);
+    if (err)
+      return err;
+
+    // array 16, 32 and fixarray
+    if (code == 0xdc || code == 0xdd || (code & 0xf0) == 0x90)
+      return emitArray(handler, size, nestingLimit);
+
+    // map 16, 32 and fixmap
+    if (code == 0xde || code == 0xdf || (code & 0xf0) == 0x80)
+      return emitObject(handler, size, nestingLimit);
+
+    // str 8, 16, 32 and fixstr
+    if (code == 0xd9 || code == 0xda || code == 0xdb || (code & 0xe0) == 0xa0) {
+      err = readString(size);
+      if (!err)
+        handler.onString(str(in_place()));
+      return err;
+    }
+
+    if (isExtension)
+      size++;  // to include the type
+
+    err = readRawString(header, uint8_t(1 + sizeBytes), size);
+    if (!err)
+      handler.onRawString(str(in_place()));
+    return err;
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitInteger(THandler& handler, uint8_t width,
+                                         bool isSigned) {
+    uint64_t value;
+    auto err = readInteger(width, isSigned, value);
+    if (err)
+      return err;
+
+    if (isSigned) {
+      auto signedValue = static_cast<int64_t>(value);
+      auto truncatedValue = static_cast<JsonInteger>(signedValue);
+      if (truncatedValue == signedValue)
+        handler.onInteger(truncatedValue);
+      else
+        handler.onNull();  // overflow
+    } else {
+      auto truncatedValue = static_cast<JsonUInt>(value);
+      if (truncatedValue == value)
+        handler.onUnsignedInteger(truncatedValue);
+      else
+        handler.onNull();  // overflow
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitArray(
+      THandler& handler, size_t n,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    handler.onStartArray();
+
+    for (; n; --n) {
+      err = emitVariant(handler, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    handler.onEndArray();
+    return DeserializationError::Ok;
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitObject(
+      THandler& handler, size_t n,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    handler.onStartObject();
+
+    for (; n; --n) {
+      err = readKey();
+      if (err)
+        return err;
+
+      handler.onKey(str(in_place()));
+
+      err = emitVariant(handler, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    handler.onEndObject();
+    return DeserializationError::Ok;
+  }
+
+  // Reads the size of a string, a binary, an extension, an array, or an object
+  DeserializationError::Code readSize(uint8_t header[5], uint8_t& sizeBytes,
+                                      size_t& size, bool& isExtension) {
+    DeserializationError::Code err;
+    const uint8_t& code = header[0];
+    sizeBytes = 0;
+    size = 0;
+    isExtension = code >= 0xc7 && code <= 0xc9;
 
     switch (code) {
       case 0xc4:  // bin 8
@@ -155,29 +365,7 @@ class MsgPackDeserializer {
         return DeserializationError::NoMemory;  // (not testable on 32/64-bit)
     }
 
-    // array 16, 32 and fixarray
-    if (code == 0xdc || code == 0xdd || (code & 0xf0) == 0x90)
-      return readArray(variant, size, filter, nestingLimit);
-
-    // map 16, 32 and fixmap
-    if (code == 0xde || code == 0xdf || (code & 0xf0) == 0x80)
-      return readObject(variant, size, filter, nestingLimit);
-
-    // str 8, 16, 32 and fixstr
-    if (code == 0xd9 || code == 0xda || code == 0xdb || (code & 0xe0) == 0xa0) {
-      if (allowValue)
-        return readString(variant, size);
-      else
-        return skipBytes(size);
-    }
-
-    if (isExtension)
-      size++;  // to include the type
-
-    if (allowValue)
-      return readRawString(variant, header, uint8_t(1 + sizeBytes), size);
-    else
-      return skipBytes(size);
+    return DeserializationError::Ok;
   }
 
   DeserializationError::Code readByte(uint8_t& value) {
@@ -207,8 +395,9 @@ class MsgPackDeserializer {
     return DeserializationError::Ok;
   }
 
-  DeserializationError::Code readInteger(VariantData* variant, uint8_t width,
-                                         bool isSigned) {
+  // Reads a big-endian integer; the sign bit is propagated if isSigned
+  DeserializationError::Code readInteger(uint8_t width, bool isSigned,
+                                         uint64_t& value) {
     uint8_t buffer[8];
 
     auto err = readBytes(buffer, width);
@@ -228,7 +417,19 @@ class MsgPackDeserializer {
     for (uint8_t i = 1; i < width; i++)
       unsignedValue = (unsignedValue << 8) | buffer[i];
 
+    value = unsignedValue;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readInteger(VariantData* variant, uint8_t width,
+                                         bool isSigned) {
+    uint64_t value;
+    auto err = readInteger(width, isSigned, value);
+    if (err)
+      return err;
+
     if (isSigned) {
+      auto signedValue = static_cast<int64_t>(value);
       auto truncatedValue = static_cast<JsonInteger>(signedValue);
       if (truncatedValue == signedValue) {
         if (!variant->setInteger(truncatedValue, resources_))
@@ -236,8 +437,8 @@ class MsgPackDeserializer {
       }
       // else set null on overflow
     } else {
-      auto truncatedValue = static_cast<JsonUInt>(unsignedValue);
-      if (truncatedValue == unsignedValue)
+      auto truncatedValue = static_cast<JsonUInt>(value);
+      if (truncatedValue == value)
         if (!variant->setInteger(truncatedValue, resources_))
           return DeserializationError::NoMemory;
       // else set null on overflow
@@ -247,45 +448,36 @@ class MsgPackDeserializer {
   }
 
   template <typename T>
-  enable_if_t<sizeof(T) == 4, DeserializationError::Code> readFloat(
-      VariantData* variant) {
+  enable_if_t<sizeof(T) == 4, DeserializationError::Code> readFloat(T& value) {
     DeserializationError::Code err;
-    T value;
 
     err = readBytes(value);
     if (err)
       return err;
 
     fixEndianness(value);
-    variant->setFloat(value, resources_);
-
     return DeserializationError::Ok;
   }
 
   template <typename T>
   enable_if_t<sizeof(T) == 8, DeserializationError::Code> readDouble(
-      VariantData* variant) {
+      T& value) {
     DeserializationError::Code err;
-    T value;
 
     err = readBytes(value);
     if (err)
       return err;
 
     fixEndianness(value);
-    if (variant->setFloat(value, resources_))
-      return DeserializationError::Ok;
-    else
-      return DeserializationError::NoMemory;
+    return DeserializationError::Ok;
   }
 
   template <typename T>
   enable_if_t<sizeof(T) == 4, DeserializationError::Code> readDouble(
-      VariantData* variant) {
+      T& value) {
     DeserializationError::Code err;
     uint8_t i[8];  // input is 8 bytes
-    T value;       // output is 4 bytes
-    uint8_t* o = reinterpret_cast<uint8_t*>(&value);
+    uint8_t* o = reinterpret_cast<uint8_t*>(&value);  // output is 4 bytes
 
     err = readBytes(i, 8);
     if (err)
@@ -293,11 +485,33 @@ class MsgPackDeserializer {
 
     doubleToFloat(i, o);
     fixEndianness(value);
-    variant->setFloat(value, resources_);
+    return DeserializationError::Ok;
+  }
 
+  template <typename T>
+  DeserializationError::Code readFloat(VariantData* variant) {
+    T value;
+    auto err = readFloat(value);
+    if (err)
+      return err;
+
+    variant->setFloat(value, resources_);
     return DeserializationError::Ok;
   }
 
+  template <typename T>
+  DeserializationError::Code readDouble(VariantData* variant) {
+    T value;
+    auto err = readDouble(value);
+    if (err)
+      return err;
+
+    if (variant->setFloat(value, resources_))
+      return DeserializationError::Ok;
+    else
+      return DeserializationError::NoMemory;
+  }
+
   DeserializationError::Code readString(VariantData* variant, size_t n) {
     DeserializationError::Code err;
 
@@ -305,11 +519,16 @@ class MsgPackDeserializer {
     if (err)
       return err;
 
-    variant->setOwnedString(stringBuffer_.save());
+    if (!variant->setString(saveString(in_place()), resources_))
+      return DeserializationError::NoMemory;
     return DeserializationError::Ok;
   }
 
   DeserializationError::Code readString(size_t n) {
+    return readString(n, in_place());
+  }
+
+  DeserializationError::Code readString(size_t n, false_type) {
     char* p = stringBuffer_.reserve(n);
     if (!p)
       return DeserializationError::NoMemory;
@@ -317,9 +536,78 @@ class MsgPackDeserializer {
     return readBytes(p, n);
   }
 
+  // Moves the characters one byte back, over the end of the header, to make
+  // room for the terminator
+  DeserializationError::Code readString(size_t n, true_type) {
+    char* p = inPlaceCursor();
+    if (!inPlaceAvailable(n))
+      return DeserializationError::IncompleteInput;
+
+    char* s = p - 1;
+    memmove(s, p, n);
+    s[n] = 0;
+    reader_.advance(p + n);
+    string_ = JsonString(s, n);
+    return DeserializationError::Ok;
+  }
+
+  StringNode* saveString(false_type) {
+    return stringBuffer_.save();
+  }
+
+  // Linked strings are null-terminated, so a string containing a NUL must be
+  // copied to the pool
+  RamString saveString(true_type) {
+    bool hasNul = memchr(string_.c_str(), 0, string_.size()) != nullptr;
+    return RamString(string_.c_str(), string_.size(), !hasNul);
+  }
+
+  JsonString str(false_type) const {
+    return stringBuffer_.str();
+  }
+
+  JsonString str(true_type) const {
+    return string_;
+  }
+
+  char* inPlaceCursor() const {
+    return reader_.buffer() + (reader_.cursor() - reader_.buffer());
+  }
+
+  // A null limit means the caller didn't give the size of the input, so the
+  // length in the header can't be checked and the string is rejected
+  bool inPlaceAvailable(size_t n) const {
+    return reader_.limit() &&
+           size_t(reader_.limit() - reader_.cursor()) >= n;
+  }
+
   DeserializationError::Code readRawString(VariantData* variant,
                                            const void* header,
                                            uint8_t headerSize, size_t n) {
+    auto err = readRawString(header, headerSize, n);
+    if (err)
+      return err;
+
+    saveRawString(variant, in_place());
+    return DeserializationError::Ok;
+  }
+
+  void saveRawString(VariantData* variant, false_type) {
+    variant->setRawString(stringBuffer_.save());
+  }
+
+  void saveRawString(VariantData* variant, true_type) {
+    variant->setLinkedRawString(string_.c_str());
+  }
+
+  DeserializationError::Code readRawString(const void* header,
+                                           uint8_t headerSize, size_t n) {
+    return readRawString(header, headerSize, n, in_place());
+  }
+
+  DeserializationError::Code readRawString(const void* header,
+                                           uint8_t headerSize, size_t n,
+                                           false_type) {
     auto totalSize = size_t(headerSize + n);
     if (totalSize < n)                        // integer overflow
       return DeserializationError::NoMemory;  // (not testable on 64-bit)
@@ -330,11 +618,19 @@ class MsgPackDeserializer {
 
     memcpy(p, header, headerSize);
 
-    auto err = readBytes(p + headerSize, n);
-    if (err)
-      return err;
+    return readBytes(p + headerSize, n);
+  }
 
-    variant->setRawString(stringBuffer_.save());
+  // The header is still in the input buffer, right before the payload, so
+  // nothing needs to move
+  DeserializationError::Code readRawString(const void*, uint8_t headerSize,
+                                           size_t n, true_type) {
+    char* p = inPlaceCursor();
+    if (!inPlaceAvailable(n))
+      return DeserializationError::IncompleteInput;
+
+    reader_.advance(p + n);
+    string_ = JsonString(p - headerSize, headerSize + n);
     return DeserializationError::Ok;
   }
 
@@ -401,15 +697,15 @@ class MsgPackDeserializer {
       if (err)
         return err;
 
-      JsonString key = stringBuffer_.str();
+      JsonString key = str(in_place());
       TFilter memberFilter = filter[key.c_str()];
       VariantData* member;
 
       if (memberFilter.allow()) {
         ARDUINOJSON_ASSERT(object != 0);
 
-        // Save key in memory pool.
-        auto savedKey = stringBuffer_.save();
+        // Save key in memory pool, or link it for in-place inputs
+        auto savedKey = saveString(in_place());
 
         member = object->addMember(savedKey, resources_);
         if (!member)
@@ -455,6 +751,7 @@ class MsgPackDeserializer {
   ResourceManager* resources_;
   TReader reader_;
   StringBuffer stringBuffer_;
+  JsonString string_;  // the last string read from an in-place input
   bool foundSomething_;
 };
 
@@ -487,4 +784,74 @@ inline DeserializationError deserializeMsgPack(TDestination&& dst, TChar* input,
                                           detail::forward<Args>(args)...);
 }
 
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TInput, typename THandler>
+inline DeserializationError parseMsgPack(
+    TInput&& input, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<MsgPackDeserializer>(
+      &resources, makeReader(detail::forward<TInput>(input)), handler,
+      nestingLimit);
+}
+
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TInput, typename THandler>
+inline DeserializationError parseMsgPack(
+    TInput&& input, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseMsgPack(detail::forward<TInput>(input), handler,
+                      detail::DefaultAllocator::instance(), nestingLimit);
+}
+
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TChar, typename THandler>
+inline DeserializationError parseMsgPack(
+    TChar* input, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<MsgPackDeserializer>(&resources, makeReader(input),
+                                          handler, nestingLimit);
+}
+
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TChar, typename THandler>
+inline DeserializationError parseMsgPack(
+    TChar* input, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseMsgPack(input, handler, detail::DefaultAllocator::instance(),
+                      nestingLimit);
+}
+
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string, which is
+// allocated with the specified allocator.
+template <typename TChar, typename THandler>
+inline DeserializationError parseMsgPack(
+    TChar* input, size_t inputSize, THandler& handler, Allocator* allocator,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  ResourceManager resources(allocator);
+  return parseEvents<MsgPackDeserializer>(
+      &resources, makeReader(input, inputSize), handler, nestingLimit);
+}
+
+// Parses a MessagePack input and calls the handler for each value, without
+// storing anything in memory, except for the current string.
+template <typename TChar, typename THandler>
+inline DeserializationError parseMsgPack(
+    TChar* input, size_t inputSize, THandler& handler,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return parseMsgPack(input, inputSize, handler,
+                      detail::DefaultAllocator::instance(), nestingLimit);
+}
+
 ARDUINOJSON_END_PUBLIC_NAMESPACE
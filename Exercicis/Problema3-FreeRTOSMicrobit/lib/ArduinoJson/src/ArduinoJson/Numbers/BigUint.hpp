@@ -0,0 +1,94 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // size_t
+#include <stdint.h>
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A fixed-capacity arbitrary-precision unsigned integer, just big enough to
+// compare a decimal number with the midpoint between two doubles.
+class BigUint {
+ public:
+  static constexpr size_t capacity = 40;  // 1280 bits
+
+  BigUint(uint64_t value) {
+    words_[0] = uint32_t(value);
+    words_[1] = uint32_t(value >> 32);
+    size_ = words_[1] ? 2 : 1;
+  }
+
+  // this = this * factor + addend
+  void multiply(uint32_t factor, uint32_t addend = 0) {
+    uint64_t carry = addend;
+    for (size_t i = 0; i < size_; i++) {
+      carry += uint64_t(words_[i]) * factor;
+      words_[i] = uint32_t(carry);
+      carry >>= 32;
+    }
+    if (carry)
+      push(uint32_t(carry));
+  }
+
+  void multiplyByPowerOfFive(int exponent) {
+    const uint32_t fiveToThe13 = 1220703125;
+    for (; exponent >= 13; exponent -= 13)
+      multiply(fiveToThe13);
+    uint32_t factor = 1;
+    while (exponent-- > 0)
+      factor *= 5;
+    multiply(factor);
+  }
+
+  void shiftLeft(int bits) {
+    ARDUINOJSON_ASSERT(bits >= 0);
+    size_t words = size_t(bits / 32);
+    int shift = bits % 32;
+    if (shift) {
+      uint32_t carry = 0;
+      for (size_t i = 0; i < size_; i++) {
+        uint32_t word = words_[i];
+        words_[i] = (word << shift) | carry;
+        carry = word >> (32 - shift);
+      }
+      if (carry)
+        push(carry);
+    }
+    if (words) {
+      ARDUINOJSON_ASSERT(size_ + words <= capacity);
+      for (size_t i = size_; i-- > 0;)
+        words_[i + words] = words_[i];
+      for (size_t i = 0; i < words; i++)
+        words_[i] = 0;
+      size_ += words;
+    }
+  }
+
+  // Returns a negative value if a < b, 0 if a == b, a positive value if a > b
+  friend int compare(const BigUint& a, const BigUint& b) {
+    if (a.size_ != b.size_)
+      return a.size_ < b.size_ ? -1 : 1;
+    for (size_t i = a.size_; i-- > 0;) {
+      if (a.words_[i] != b.words_[i])
+        return a.words_[i] < b.words_[i] ? -1 : 1;
+    }
+    return 0;
+  }
+
+ private:
+  void push(uint32_t word) {
+    ARDUINOJSON_ASSERT(size_ < capacity);
+    words_[size_++] = word;
+  }
+
+  uint32_t words_[capacity];
+  size_t size_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
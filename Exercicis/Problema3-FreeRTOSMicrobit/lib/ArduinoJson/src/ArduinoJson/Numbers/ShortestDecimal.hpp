@@ -0,0 +1,170 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+#include <ArduinoJson/Numbers/DiyFp.hpp>
+#include <ArduinoJson/Numbers/FloatTraits.hpp>
+#include <ArduinoJson/Polyfills/alias_cast.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The shortest decimal that reads back as the same floating-point value:
+//   value = digits * 10^exponent
+struct ShortestDecimal {
+  char digits[17];
+  uint8_t length;
+  int16_t exponent;
+};
+
+// Implementation of the Grisu2 algorithm from Florian Loitsch's paper
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers".
+// The result always reads back as the original value, and is the shortest
+// possible for all but a tiny fraction of the inputs.
+class Grisu2 {
+ public:
+  // Requires a finite, strictly positive value
+  template <typename TFloat>
+  static ShortestDecimal convert(TFloat value) {
+    ARDUINOJSON_ASSERT(value > 0);
+    DiyFp minus, plus;
+    DiyFp v = computeBoundaries(value, minus, plus);
+
+    // scale by a power of ten, so that plus.e lands in [alpha, gamma]
+    int16_t k;
+    DiyFp c = cachedPower(plus.e, k);
+    DiyFp w = DiyFp::multiply(v, c);
+    DiyFp wMinus = DiyFp::multiply(minus, c);
+    DiyFp wPlus = DiyFp::multiply(plus, c);
+
+    // shrink the interval by 1 ulp on each side to stay safe after rounding
+    wMinus.f++;
+    wPlus.f--;
+
+    ShortestDecimal result;
+    result.length = 0;
+    result.exponent = k;
+    generateDigits(result, wMinus, w, wPlus);
+    return result;
+  }
+
+ private:
+  static constexpr int alpha = -60;
+  static constexpr int gamma = -32;
+
+  template <typename TFloat>
+  static DiyFp computeBoundaries(TFloat value, DiyFp& minus, DiyFp& plus) {
+    using traits = FloatTraits<TFloat>;
+    using bits_type = typename traits::mantissa_type;
+    const int mantissaBits = traits::mantissa_bits;
+    const int exponentBits = int(sizeof(TFloat) * 8) - 1 - mantissaBits;
+    const int bias = (1 << (exponentBits - 1)) - 1 + mantissaBits;
+    const uint64_t hiddenBit = uint64_t(1) << mantissaBits;
+
+    auto bits = alias_cast<bits_type>(value);
+    auto biasedExponent = int(bits >> mantissaBits);
+    auto fraction = uint64_t(bits) & (hiddenBit - 1);
+
+    DiyFp v;
+    if (biasedExponent == 0) {  // subnormal
+      v.f = fraction;
+      v.e = 1 - bias;
+    } else {
+      v.f = fraction + hiddenBit;
+      v.e = biasedExponent - bias;
+    }
+
+    // the boundaries are halfway to the neighbors
+    // the lower one is closer when the fraction is zero (power of two)
+    plus = DiyFp::normalize({2 * v.f + 1, v.e - 1});
+    if (fraction == 0 && biasedExponent > 1)
+      minus = {4 * v.f - 1, v.e - 2};
+    else
+      minus = {2 * v.f - 1, v.e - 1};
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    return DiyFp::normalize(v);
+  }
+
+  // Returns c = 10^-k such that alpha <= e + c.e + 64 <= gamma
+  static DiyFp cachedPower(int e, int16_t& k) {
+    const int step = DiyFp::cachedPowersStep;
+
+    // ceil((alpha - e - 1) * log10(2))
+    int32_t f = alpha - e - 1;
+    int32_t decimalExponent = (f * 78913) / (int32_t(1) << 18) + (f > 0);
+    int index = int(
+        (decimalExponent - DiyFp::cachedPowersMinExponent + step - 1) / step);
+
+    k = int16_t(-(DiyFp::cachedPowersMinExponent + index * step));
+    DiyFp c = DiyFp::cachedPowerOfTen(index);
+    ARDUINOJSON_ASSERT(alpha <= e + c.e + 64 && e + c.e + 64 <= gamma);
+    return c;
+  }
+
+  // Generates the shortest digits of w that lie within [low, high]
+  static void generateDigits(ShortestDecimal& result, DiyFp low, DiyFp w,
+                             DiyFp high) {
+    uint64_t delta = high.f - low.f;
+    uint64_t distance = high.f - w.f;
+
+    int shift = -high.e;
+    uint64_t one = uint64_t(1) << shift;
+    auto integral = uint32_t(high.f >> shift);  // fits since e >= alpha
+    uint64_t fractional = high.f & (one - 1);
+
+    uint32_t divisor = 1;
+    int remainingDigits = 1;
+    while (integral / divisor >= 10) {
+      divisor *= 10;
+      remainingDigits++;
+    }
+
+    while (remainingDigits > 0) {
+      auto digit = integral / divisor;
+      integral %= divisor;
+      result.digits[result.length++] = char('0' + digit);
+      remainingDigits--;
+
+      uint64_t rest = (uint64_t(integral) << shift) + fractional;
+      if (rest <= delta) {
+        result.exponent = int16_t(result.exponent + remainingDigits);
+        adjustLastDigit(result, distance, delta, rest,
+                        uint64_t(divisor) << shift);
+        return;
+      }
+      divisor /= 10;
+    }
+
+    // the integral part isn't enough, generate the fractional digits
+    for (;;) {
+      fractional *= 10;
+      delta *= 10;
+      distance *= 10;
+      result.digits[result.length++] = char('0' + (fractional >> shift));
+      fractional &= one - 1;
+      result.exponent--;
+      if (fractional <= delta)
+        break;
+    }
+    adjustLastDigit(result, distance, delta, fractional, one);
+  }
+
+  // Moves the last digit closer to w, while staying in the interval
+  static void adjustLastDigit(ShortestDecimal& result, uint64_t distance,
+                              uint64_t delta, uint64_t rest, uint64_t tenK) {
+    while (rest < distance && delta - rest >= tenK &&
+           (rest + tenK < distance ||
+            distance - rest > rest + tenK - distance)) {
+      result.digits[result.length - 1]--;
+      rest += tenK;
+    }
+  }
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <ArduinoJson/Numbers/BigUint.hpp>
+#include <ArduinoJson/Numbers/DiyFp.hpp>
 #include <ArduinoJson/Numbers/FloatTraits.hpp>
 #include <ArduinoJson/Numbers/JsonFloat.hpp>
 #include <ArduinoJson/Numbers/convertNumber.hpp>
@@ -12,6 +14,8 @@
 #include <ArduinoJson/Polyfills/math.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 
+#include <string.h>  // memcpy
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 template <typename A, typename B>
@@ -102,6 +106,177 @@ class Number {
 #endif
 };
 
+#if ARDUINOJSON_LITTLE_ENDIAN && ARDUINOJSON_SIZEOF_POINTER > 2
+// Converts 8 digits at once ("SIMD within a register")
+inline uint32_t parseEightDigits(const char* s) {
+  uint64_t value;
+  memcpy(&value, s, sizeof(value));
+  value -= 0x3030303030303030;          // from ASCII
+  value = (value * 10) + (value >> 8);  // combine pairs of digits
+  value = (((value & 0x000000FF000000FF) * 0x000F424000000064) +
+           (((value >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >>
+          32;  // combine the pairs: 1000000, 10000, 100, 1
+  return uint32_t(value);
+}
+#endif
+
+// Appends the digits to the mantissa, as long as it doesn't exceed max.
+// Returns a pointer to the first character that was not consumed.
+template <typename T>
+inline const char* parseDigits(const char* s, T& mantissa, T max) {
+#if ARDUINOJSON_LITTLE_ENDIAN && ARDUINOJSON_SIZEOF_POINTER > 2
+  const char* end = s;
+  while (isdigit(*end))
+    end++;
+  while (end - s >= 8 && max > 99999999 &&
+         mantissa <= (max - 99999999) / 100000000) {
+    mantissa = T(mantissa * 100000000 + parseEightDigits(s));
+    s += 8;
+  }
+#endif
+
+  while (isdigit(*s)) {
+    uint8_t digit = uint8_t(*s - '0');
+    if (mantissa > (max - digit) / 10)
+      break;
+    mantissa = T(mantissa * 10 + digit);
+    s++;
+  }
+  return s;
+}
+
+#if ARDUINOJSON_SIZEOF_POINTER > 2
+// Computes m * 10^e with a 64-bit significand, then rounds to the nearest
+// float. When the product is too close to the midpoint between two floats,
+// the decimal number is compared with the midpoint using big integers.
+// If digits were dropped from m, digits points to the first digit of the
+// number, and droppedDigits is the number of digits that were dropped.
+// Returns false if the power of ten is out of the range of the table.
+template <typename TFloat>
+inline bool make_float_extended(uint64_t m, int e, const char* digits,
+                                int droppedDigits, TFloat& result) {
+  using traits = FloatTraits<TFloat>;
+  using bits_type = typename traits::mantissa_type;
+  const int mantissaBits = traits::mantissa_bits;
+  const int exponentBits = int(sizeof(TFloat) * 8) - 1 - mantissaBits;
+  const int bias = (1 << (exponentBits - 1)) - 1;
+  const int maxBiasedExponent = (1 << exponentBits) - 1;
+
+  ARDUINOJSON_ASSERT(m != 0);
+  if (e < DiyFp::cachedPowersMinExponent ||
+      e >= DiyFp::cachedPowersMaxExponent + DiyFp::cachedPowersStep)
+    return false;
+
+  // 10^e = cached power * 10^remainder
+  int index = (e - DiyFp::cachedPowersMinExponent) / DiyFp::cachedPowersStep;
+  int remainder =
+      e - DiyFp::cachedPowersMinExponent - index * DiyFp::cachedPowersStep;
+  DiyFp power = DiyFp::cachedPowerOfTen(index);
+  if (remainder) {
+    uint64_t smallPower = 1;
+    while (remainder--)
+      smallPower *= 10;
+    power = DiyFp::multiply(power, DiyFp::normalize({smallPower, 0}));
+  }
+  DiyFp x = DiyFp::normalize(
+      DiyFp::multiply(DiyFp::normalize({m, 0}), DiyFp::normalize(power)));
+
+  // x = 1.xxx * 2^(x.e + 63)
+  int biasedExponent = x.e + 63 + bias;
+  int shift = 63 - mantissaBits;
+  if (biasedExponent <= 0) {  // subnormal
+    shift += 1 - biasedExponent;
+    biasedExponent = 0;
+  }
+  if (shift > 64) {  // less than half the smallest subnormal
+    result = 0;
+    return true;
+  }
+
+  uint64_t significand = shift < 64 ? x.f >> shift : 0;
+  uint64_t rest = shift < 64 ? x.f & ((uint64_t(1) << shift) - 1) : x.f;
+  uint64_t half = uint64_t(1) << (shift - 1);
+
+  // x is within a few units of the exact product
+  // (the dropped digits add a few more units)
+  const uint64_t errorMargin = digits ? 32 : 16;
+  int comparison;
+  if (rest + errorMargin >= half && rest <= half + errorMargin) {
+    // compare value * 10^e with midpoint * 2^(x.e + shift - 1)
+    BigUint value(m), midpoint(2 * significand + 1);
+    if (digits) {
+      // use all the digits, not only the ones that fit in m
+      // (up to a limit, to keep the big integers within their capacity)
+      const int maxDigits = 64;
+      int count = 0;
+      value = BigUint(0);
+      e -= droppedDigits;
+      for (; isdigit(*digits) || *digits == '.'; digits++) {
+        if (*digits == '.')
+          continue;
+        if (count++ < maxDigits)
+          value.multiply(10, uint32_t(*digits - '0'));
+        else
+          e++;
+      }
+    }
+    if (e >= 0)
+      value.multiplyByPowerOfFive(e);
+    else
+      midpoint.multiplyByPowerOfFive(-e);
+    int binaryExponent = x.e + shift - 1;
+    if (e > binaryExponent)
+      value.shiftLeft(e - binaryExponent);
+    else
+      midpoint.shiftLeft(binaryExponent - e);
+    comparison = compare(value, midpoint);
+  } else {
+    comparison = rest > half ? 1 : rest < half ? -1 : 0;
+  }
+
+  // round half to even
+  if (comparison > 0 || (comparison == 0 && (significand & 1)))
+    significand++;
+
+  if (significand >> (mantissaBits + 1)) {  // rounded up to the next power of 2
+    significand >>= 1;
+    biasedExponent++;
+  } else if (biasedExponent == 0 && (significand >> mantissaBits)) {
+    biasedExponent = 1;  // rounded up to the smallest normal
+  }
+
+  if (biasedExponent >= maxBiasedExponent) {
+    result = traits::inf();
+    return true;
+  }
+
+  auto bits = (bits_type(biasedExponent) << mantissaBits) |
+              bits_type(significand & ((uint64_t(1) << mantissaBits) - 1));
+  result = traits::forge(bits);
+  return true;
+}
+#endif
+
+// Computes mantissa * 10^exponent
+// If significant digits were dropped from the mantissa, digits points to the
+// first digit of the number, and droppedDigits is the number of digits that
+// were dropped; otherwise, digits is nullptr.
+template <typename TFloat, typename TMantissa>
+inline TFloat decimalToFloat(TMantissa mantissa, int exponent,
+                             const char* digits, int droppedDigits) {
+  TFloat result;
+  if (!digits && make_exact_float(mantissa, exponent, result))
+    return result;
+#if ARDUINOJSON_SIZEOF_POINTER > 2
+  if (mantissa != 0 && make_float_extended(uint64_t(mantissa), exponent,
+                                           digits, droppedDigits, result))
+    return result;
+#else
+  (void)droppedDigits;
+#endif
+  return make_float(TFloat(mantissa), exponent);
+}
+
 inline Number parseNumber(const char* s) {
   using traits = FloatTraits<JsonFloat>;
   using mantissa_t = largest_type<traits::mantissa_type, JsonUInt>;
@@ -138,17 +313,11 @@ inline Number parseNumber(const char* s) {
   mantissa_t mantissa = 0;
   exponent_t exponent_offset = 0;
   const mantissa_t maxUint = JsonUInt(-1);
+  const char* digits = s;
+  int droppedDigits = 0;
+  bool exact = true;  // becomes false when a non-zero digit is dropped
 
-  while (isdigit(*s)) {
-    uint8_t digit = uint8_t(*s - '0');
-    if (mantissa > maxUint / 10)
-      break;
-    mantissa *= 10;
-    if (mantissa > maxUint - digit)
-      break;
-    mantissa += digit;
-    s++;
-  }
+  s = parseDigits(s, mantissa, maxUint);
 
   if (*s == '\0') {
     if (is_negative) {
@@ -162,25 +331,26 @@ inline Number parseNumber(const char* s) {
     }
   }
 
-  // avoid mantissa overflow
-  while (mantissa > traits::mantissa_max) {
-    mantissa /= 10;
-    exponent_offset++;
-  }
-
   // remaing digits can't fit in the mantissa
   while (isdigit(*s)) {
+    exact = exact && *s == '0';
+    droppedDigits++;
     exponent_offset++;
     s++;
   }
 
   if (*s == '.') {
     s++;
+    if (droppedDigits == 0) {
+      const char* decimals = s;
+      s = parseDigits(s, mantissa, maxUint);
+      exponent_offset = exponent_t(exponent_offset - (s - decimals));
+    }
+
+    // remaining decimals can't fit in the mantissa
     while (isdigit(*s)) {
-      if (mantissa < traits::mantissa_max / 10) {
-        mantissa = mantissa * 10 + uint8_t(*s - '0');
-        exponent_offset--;
-      }
+      exact = exact && *s == '0';
+      droppedDigits++;
       s++;
     }
   }
@@ -220,12 +390,14 @@ inline Number parseNumber(const char* s) {
                   exponent > FloatTraits<float>::exponent_max ||
                   mantissa > FloatTraits<float>::mantissa_max;
   if (isDouble) {
-    auto final_result = make_float(double(mantissa), exponent);
+    auto final_result = decimalToFloat<double>(
+        mantissa, exponent, exact ? nullptr : digits, droppedDigits);
     return Number(is_negative ? -final_result : final_result);
   } else
 #endif
   {
-    auto final_result = make_float(float(mantissa), exponent);
+    auto final_result = decimalToFloat<float>(
+        mantissa, exponent, exact ? nullptr : digits, droppedDigits);
     return Number(is_negative ? -final_result : final_result);
   }
 }
@@ -160,6 +160,15 @@ class JsonObject : public detail::VariantOperators<JsonObject> {
                                      resources_);
   }
 
+  // Indexes the keys, so that lookups in a large object don't compare them
+  // one by one. The document keeps one object index: building it for this
+  // object drops the previous one. deserializeJson() indexes the root.
+  // Returns false if ARDUINOJSON_ENABLE_OBJECT_INDEX is 0 or if there wasn't
+  // enough memory.
+  bool buildIndex() const {
+    return detail::ObjectData::buildIndex(data_, resources_);
+  }
+
   // DEPRECATED: use obj[key].is<T>() instead
   // https://arduinojson.org/v7/api/jsonobject/containskey/
   template <typename TString,
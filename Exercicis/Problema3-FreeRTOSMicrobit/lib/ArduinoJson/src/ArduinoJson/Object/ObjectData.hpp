@@ -20,6 +20,19 @@ class ObjectData : public CollectionData {
   VariantData* getMember(TAdaptedString key,
                          const ResourceManager* resources) const;
 
+  // Like getMember(), but might index the object after a long search
+  template <typename TAdaptedString>
+  VariantData* getMember(TAdaptedString key, ResourceManager* resources);
+
+  // Like getMember(), but tries the member at the specified position first,
+  // then updates it with the position of the member found.
+  // Only a frozen document has its members in consecutive slots, where the
+  // position is reached in one step; otherwise, the members before it are
+  // walked (without comparing their keys), unless the object is indexed.
+  template <typename TAdaptedString>
+  VariantData* getMember(TAdaptedString key, size_t& hint,
+                         const ResourceManager* resources) const;
+
   template <typename TAdaptedString>
   static VariantData* getMember(const ObjectData* object, TAdaptedString key,
                                 const ResourceManager* resources) {
@@ -39,10 +52,18 @@ class ObjectData : public CollectionData {
     obj->removeMember(key, resources);
   }
 
-  void remove(iterator it, ResourceManager* resources) {
-    CollectionData::removePair(it, resources);
+  // Indexes the keys, unless the object is small.
+  // Returns false if the index is disabled or couldn't be allocated.
+  bool buildIndex(ResourceManager* resources);
+
+  static bool buildIndex(ObjectData* obj, ResourceManager* resources) {
+    if (!obj)
+      return false;
+    return obj->buildIndex(resources);
   }
 
+  void remove(iterator it, ResourceManager* resources);
+
   static void remove(ObjectData* obj, ObjectData::iterator it,
                      ResourceManager* resources) {
     if (!obj)
@@ -61,8 +82,14 @@ class ObjectData : public CollectionData {
   }
 
  private:
+  // Counts the members that a linear search visited (zero if it used the
+  // index)
+  template <typename TAdaptedString>
+  iterator findKey(TAdaptedString key, const ResourceManager* resources,
+                   size_t& members) const;
+
   template <typename TAdaptedString>
-  iterator findKey(TAdaptedString key, const ResourceManager* resources) const;
+  iterator findKey(TAdaptedString key, ResourceManager* resources);
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
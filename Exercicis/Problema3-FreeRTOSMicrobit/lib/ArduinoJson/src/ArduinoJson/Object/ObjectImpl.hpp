@@ -13,6 +13,17 @@ ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 template <typename TAdaptedString>
 inline VariantData* ObjectData::getMember(
     TAdaptedString key, const ResourceManager* resources) const {
+  size_t members;
+  auto it = findKey(key, resources, members);
+  if (it.done())
+    return nullptr;
+  it.next(resources);
+  return it.data();
+}
+
+template <typename TAdaptedString>
+inline VariantData* ObjectData::getMember(TAdaptedString key,
+                                          ResourceManager* resources) {
   auto it = findKey(key, resources);
   if (it.done())
     return nullptr;
@@ -20,6 +31,48 @@ inline VariantData* ObjectData::getMember(
   return it.data();
 }
 
+template <typename TAdaptedString>
+inline VariantData* ObjectData::getMember(
+    TAdaptedString key, size_t& hint, const ResourceManager* resources) const {
+  if (key.isNull())
+    return nullptr;
+
+  iterator it;
+  if (resources->frozen()) {  // the members are in consecutive slots
+    if (head() != NULL_SLOT && 2 * hint < size_t(tail() - head())) {
+      auto id = SlotId(head() + 2 * hint);
+      it = iterator(resources->getVariant(id), id);
+    }
+  } else {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    if (resources->objectIndex().covers(this))
+      return getMember(key, resources);
+#endif
+    it = createIterator(resources);
+    for (size_t i = 0; i < 2 * hint && !it.done(); i++)
+      it.next(resources);
+  }
+  if (!it.done() && stringEquals(key, adaptString(it->asString()))) {
+    it.next(resources);
+    return it.data();
+  }
+
+  // the layout changed: search from the start and remember the position
+  size_t position = 0;
+  bool isKey = true;
+  for (it = createIterator(resources); !it.done(); it.next(resources)) {
+    if (isKey && stringEquals(key, adaptString(it->asString()))) {
+      hint = position;
+      it.next(resources);
+      return it.data();
+    }
+    if (isKey)
+      position++;
+    isKey = !isKey;
+  }
+  return nullptr;
+}
+
 template <typename TAdaptedString>
 VariantData* ObjectData::getOrAddMember(TAdaptedString key,
                                         ResourceManager* resources) {
@@ -31,16 +84,44 @@ VariantData* ObjectData::getOrAddMember(TAdaptedString key,
 
 template <typename TAdaptedString>
 inline ObjectData::iterator ObjectData::findKey(
-    TAdaptedString key, const ResourceManager* resources) const {
+    TAdaptedString key, const ResourceManager* resources,
+    size_t& members) const {
+  members = 0;
   if (key.isNull())
     return iterator();
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  // only read the index, so that const lookups can run concurrently
+  auto& index = resources->objectIndex();
+  if (index.covers(this)) {
+    auto keyId = index.find(key, resources);
+    return iterator(resources->getVariant(keyId), keyId);
+  }
+#endif
   bool isKey = true;
-  for (auto it = createIterator(resources); !it.done(); it.next(resources)) {
+  auto it = createIterator(resources);
+  for (; !it.done(); it.next(resources)) {
     if (isKey && stringEquals(key, adaptString(it->asString())))
-      return it;
+      break;
+    if (isKey)
+      members++;
     isKey = !isKey;
   }
-  return iterator();
+  return it;
+}
+
+template <typename TAdaptedString>
+inline ObjectData::iterator ObjectData::findKey(TAdaptedString key,
+                                                ResourceManager* resources) {
+  size_t members;
+  const ResourceManager* constResources = resources;
+  auto it = findKey(key, constResources, members);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  // a frozen document can be read from several threads, so it must not
+  // update the index
+  if (members && !resources->frozen())
+    resources->objectIndex().onLinearSearch(this, members, resources);
+#endif
+  return it;
 }
 
 template <typename TAdaptedString>
@@ -65,9 +146,145 @@ inline VariantData* ObjectData::addMember(TAdaptedString key,
 
   CollectionData::appendPair(keySlot, valueSlot, resources);
 
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  if (resources->objectIndex().covers(this))
+    resources->objectIndex().insert(keySlot.id(), resources);
+#endif
+
   return valueSlot.ptr();
 }
 
+inline bool ObjectData::buildIndex(ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  return resources->objectIndex().cover(this, resources);
+#else
+  (void)resources;  // silence warning
+  return false;
+#endif
+}
+
+inline void ObjectData::remove(iterator it, ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  if (!it.done() && resources->objectIndex().covers(this))
+    resources->objectIndex().remove(it.data(), resources);
+#endif
+  CollectionData::removePair(it, resources);
+}
+
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+template <typename TAdaptedString>
+inline SlotId ObjectIndex::find(TAdaptedString key,
+                                const ResourceManager* resources) const {
+  ARDUINOJSON_ASSERT(table_ != nullptr);
+  size_t mask = capacity_ - 1;
+  for (size_t i = stringHash(key) & mask;; i = (i + 1) & mask) {
+    auto keyId = table_[i];
+    if (keyId == NULL_SLOT ||
+        stringEquals(key,
+                     adaptString(resources->getVariant(keyId)->asString())))
+      return keyId;
+  }
+}
+
+inline bool ObjectIndex::cover(const CollectionData* object,
+                               const ResourceManager* resources) {
+  if (object_ == object || object->size(resources) < 2 * minMembers)
+    return true;
+  object_ = build(object, resources) ? object : nullptr;
+  return object_ != nullptr;
+}
+
+inline void ObjectIndex::onLinearSearch(const CollectionData* object,
+                                        size_t members,
+                                        const ResourceManager* resources) {
+  if (members < minMembers)
+    return;
+  if (candidate_ != object) {
+    // wait for a second search to avoid thrashing between two objects
+    candidate_ = object;
+    return;
+  }
+  object_ = build(object, resources) ? object : nullptr;
+}
+
+inline void ObjectIndex::insert(SlotId keyId,
+                                const ResourceManager* resources) {
+  ARDUINOJSON_ASSERT(object_ != nullptr);
+  if (hasRoomFor(count_ + 1))
+    insertSlot(keyId, resources);
+  else if (!build(object_, resources))
+    object_ = nullptr;  // fall back to linear search
+}
+
+inline void ObjectIndex::remove(const VariantData* key,
+                                const ResourceManager* resources) {
+  ARDUINOJSON_ASSERT(object_ != nullptr);
+  size_t mask = capacity_ - 1;
+  size_t i = stringHash(adaptString(key->asString())) & mask;
+  while (resources->getVariant(table_[i]) != key) {
+    ARDUINOJSON_ASSERT(table_[i] != NULL_SLOT);
+    i = (i + 1) & mask;
+  }
+
+  // backward-shift deletion: no tombstones needed
+  for (size_t j = (i + 1) & mask; table_[j] != NULL_SLOT; j = (j + 1) & mask) {
+    size_t home = hashOf(table_[j], resources) & mask;
+    // move table_[j] to the hole if the hole lies between home and j
+    if (((j - home) & mask) >= ((j - i) & mask)) {
+      table_[i] = table_[j];
+      i = j;
+    }
+  }
+  table_[i] = NULL_SLOT;
+  count_--;
+}
+
+inline bool ObjectIndex::build(const CollectionData* object,
+                               const ResourceManager* resources) {
+  size_t members = object->size(resources) / 2;
+  size_t capacity = 2 * minMembers;
+  while (capacity < 2 * members)  // keep the load factor under 50%
+    capacity *= 2;
+
+  if (capacity != capacity_) {
+    auto allocator = resources->allocator();
+    if (table_)
+      allocator->deallocate(table_);
+    table_ = reinterpret_cast<SlotId*>(
+        allocator->allocate(capacity * sizeof(SlotId)));
+    capacity_ = table_ ? capacity : 0;
+    if (!table_)
+      return false;
+  }
+
+  memset(table_, 0xFF, capacity_ * sizeof(SlotId));  // fill with NULL_SLOT
+  count_ = 0;
+
+  auto keyId = object->head();
+  while (keyId != NULL_SLOT) {
+    insertSlot(keyId, resources);
+    auto valueId = resources->getVariant(keyId)->next();
+    keyId = resources->getVariant(valueId)->next();
+  }
+  return true;
+}
+
+inline void ObjectIndex::insertSlot(SlotId keyId,
+                                    const ResourceManager* resources) {
+  size_t mask = capacity_ - 1;
+  size_t i = hashOf(keyId, resources) & mask;
+  while (table_[i] != NULL_SLOT)
+    i = (i + 1) & mask;
+  table_[i] = keyId;
+  count_++;
+}
+
+inline uint32_t ObjectIndex::hashOf(SlotId keyId,
+                                    const ResourceManager* resources) {
+  return stringHash(adaptString(resources->getVariant(keyId)->asString()));
+}
+#endif
+
 // Returns the size (in bytes) of an object with n members.
 constexpr size_t sizeofObject(size_t n) {
   return 2 * n * ResourceManager::slotSize;
@@ -0,0 +1,110 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+#include <string.h>  // memset
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+class CollectionData;
+class ResourceManager;
+class VariantData;
+
+// Open-addressing hash table (linear probing) of the key slots of one large
+// object: the root of the last deserialized document, the last one passed to
+// JsonObject::buildIndex(), or the last one that was searched twice in a row by
+// a non-const lookup, such as the duplicate-key check of deserializeJson() or
+// getOrAddMember().
+// Const lookups only read it, so that several threads can read a document.
+// ObjectData keeps it in sync when members are added or removed, and
+// ResourceManager drops it when slots might move.
+class ObjectIndex {
+ public:
+  // Below this number of members, a linear search is faster
+  static constexpr size_t minMembers = 16;
+
+  ObjectIndex() = default;
+  ObjectIndex(const ObjectIndex&) = delete;
+  void operator=(const ObjectIndex&) = delete;
+
+  ~ObjectIndex() {
+    ARDUINOJSON_ASSERT(table_ == nullptr);
+  }
+
+  friend void swap(ObjectIndex& a, ObjectIndex& b) {
+    swap_(a.table_, b.table_);
+    swap_(a.capacity_, b.capacity_);
+    swap_(a.count_, b.count_);
+    swap_(a.object_, b.object_);
+    swap_(a.candidate_, b.candidate_);
+  }
+
+  bool covers(const CollectionData* object) const {
+    return object_ && object_ == object;
+  }
+
+  // Returns the id of the key slot, or NULL_SLOT if not found
+  template <typename TAdaptedString>
+  SlotId find(TAdaptedString key, const ResourceManager* resources) const;
+
+  // Builds the table of the specified object, unless it's small.
+  // Returns false if there wasn't enough memory.
+  bool cover(const CollectionData* object, const ResourceManager* resources);
+
+  // Called after a linear search visited the specified number of members
+  void onLinearSearch(const CollectionData* object, size_t members,
+                      const ResourceManager* resources);
+
+  // Called after a member was appended to the object
+  void insert(SlotId keyId, const ResourceManager* resources);
+
+  // Called before a member is removed from the object
+  void remove(const VariantData* key, const ResourceManager* resources);
+
+  // Called when the object is destroyed
+  void invalidate(const CollectionData* object) {
+    if (object_ == object)
+      object_ = nullptr;
+    if (candidate_ == object)
+      candidate_ = nullptr;
+  }
+
+  // Called when the slots are moved or swapped
+  void reset() {
+    object_ = nullptr;
+    candidate_ = nullptr;
+  }
+
+  void clear(Allocator* allocator) {
+    reset();
+    if (table_)
+      allocator->deallocate(table_);
+    table_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+  }
+
+ private:
+  bool build(const CollectionData* object, const ResourceManager* resources);
+  void insertSlot(SlotId keyId, const ResourceManager* resources);
+  static uint32_t hashOf(SlotId keyId, const ResourceManager* resources);
+
+  bool hasRoomFor(size_t count) const {
+    return 4 * count <= 3 * capacity_;
+  }
+
+  SlotId* table_ = nullptr;
+  size_t capacity_ = 0;
+  size_t count_ = 0;
+  const CollectionData* object_ = nullptr;
+  const CollectionData* candidate_ = nullptr;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
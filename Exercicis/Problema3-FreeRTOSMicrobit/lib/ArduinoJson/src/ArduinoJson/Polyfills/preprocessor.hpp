@@ -12,6 +12,10 @@
   ARDUINOJSON_CONCAT2(ARDUINOJSON_CONCAT3(A, B, C), D)
 #define ARDUINOJSON_CONCAT5(A, B, C, D, E) \
   ARDUINOJSON_CONCAT2(ARDUINOJSON_CONCAT4(A, B, C, D), E)
+#define ARDUINOJSON_CONCAT6(A, B, C, D, E, F) \
+  ARDUINOJSON_CONCAT2(ARDUINOJSON_CONCAT5(A, B, C, D, E), F)
+#define ARDUINOJSON_CONCAT7(A, B, C, D, E, F, G) \
+  ARDUINOJSON_CONCAT2(ARDUINOJSON_CONCAT6(A, B, C, D, E, F), G)
 
 #define ARDUINOJSON_BIN2ALPHA_0000() A
 #define ARDUINOJSON_BIN2ALPHA_0001() B
@@ -0,0 +1,162 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A destination for serializeJson() and serializeMsgPack() that grows by
+// chunks of fixed size, so the output doesn't have to be measured first.
+// The chunks can be sent as is, for example with toIovec() and sendmsg().
+class ChunkedBuffer {
+ public:
+  class Chunk {
+   public:
+    const char* data() const {
+      return reinterpret_cast<const char*>(this + 1);
+    }
+
+    size_t size() const {
+      return size_;
+    }
+
+    // Returns null after the last chunk with data
+    const Chunk* next() const {
+      return next_ && next_->size_ ? next_ : nullptr;
+    }
+
+   private:
+    friend class ChunkedBuffer;
+
+    char* buffer() {
+      return reinterpret_cast<char*>(this + 1);
+    }
+
+    Chunk* next_;
+    size_t size_;
+  };
+
+  explicit ChunkedBuffer(
+      size_t chunkSize = 256,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : allocator_(allocator), chunkSize_(chunkSize) {
+    ARDUINOJSON_ASSERT(chunkSize > 0);
+  }
+
+  ChunkedBuffer(const ChunkedBuffer&) = delete;
+  ChunkedBuffer& operator=(const ChunkedBuffer&) = delete;
+
+  ~ChunkedBuffer() {
+    while (head_) {
+      auto next = head_->next_;
+      allocator_->deallocate(head_);
+      head_ = next;
+    }
+  }
+
+  size_t write(uint8_t c) {
+    if ((!current_ || current_->size_ == chunkSize_) && !nextChunk())
+      return 0;
+    current_->buffer()[current_->size_++] = static_cast<char>(c);
+    size_++;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    size_t written = 0;
+    while (written < n) {
+      if ((!current_ || current_->size_ == chunkSize_) && !nextChunk())
+        break;
+      size_t room = chunkSize_ - current_->size_;
+      size_t k = n - written < room ? n - written : room;
+      memcpy(current_->buffer() + current_->size_, s + written, k);
+      current_->size_ += k;
+      written += k;
+    }
+    size_ += written;
+    return written;
+  }
+
+  // Empties the buffer but keeps the chunks for the next output
+  void clear() {
+    for (auto chunk = head_; chunk; chunk = chunk->next_)
+      chunk->size_ = 0;
+    current_ = head_;
+    size_ = 0;
+    overflowed_ = false;
+  }
+
+  // Returns the total number of bytes
+  size_t size() const {
+    return size_;
+  }
+
+  // Returns true if a chunk couldn't be allocated
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+  const Chunk* firstChunk() const {
+    return head_ && head_->size_ ? head_ : nullptr;
+  }
+
+  size_t chunkCount() const {
+    size_t n = 0;
+    for (auto chunk = firstChunk(); chunk; chunk = chunk->next())
+      n++;
+    return n;
+  }
+
+  // Fills an array of struct iovec (or any type with iov_base and iov_len)
+  // and returns the number of entries used
+  template <typename TIovec>
+  size_t toIovec(TIovec* iov, size_t maxCount) const {
+    size_t n = 0;
+    for (auto chunk = firstChunk(); chunk && n < maxCount;
+         chunk = chunk->next()) {
+      iov[n].iov_base = const_cast<char*>(chunk->data());
+      iov[n].iov_len = chunk->size();
+      n++;
+    }
+    return n;
+  }
+
+ private:
+  bool nextChunk() {
+    if (current_ && current_->next_) {  // reuse a chunk kept by clear()
+      current_ = current_->next_;
+      return true;
+    }
+
+    auto chunk = static_cast<Chunk*>(
+        allocator_->allocate(sizeof(Chunk) + chunkSize_));
+    if (!chunk) {
+      overflowed_ = true;
+      return false;
+    }
+    chunk->next_ = nullptr;
+    chunk->size_ = 0;
+
+    if (current_)
+      current_->next_ = chunk;
+    else
+      head_ = chunk;
+    current_ = chunk;
+    return true;
+  }
+
+  Allocator* allocator_;
+  size_t chunkSize_;
+  Chunk* head_ = nullptr;
+  Chunk* current_ = nullptr;
+  size_t size_ = 0;
+  bool overflowed_ = false;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
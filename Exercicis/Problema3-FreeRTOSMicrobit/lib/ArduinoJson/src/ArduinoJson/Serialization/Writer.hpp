@@ -28,6 +28,7 @@ class Writer {
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
 
+#include <ArduinoJson/Serialization/Writers/BufferedWriter.hpp>
 #include <ArduinoJson/Serialization/Writers/StaticStringWriter.hpp>
 
 #if ARDUINOJSON_ENABLE_STD_STRING
@@ -0,0 +1,63 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A writer is bufferable if each call to write() is expensive, for example a
+// virtual call and a lock per byte
+template <typename TWriter>
+struct IsBufferableWriter : false_type {};
+
+// Coalesces the output in a block that is written in bulk when it's full.
+// Call flush() to write the rest.
+template <typename TWriter>
+class BufferedWriter {
+ public:
+  explicit BufferedWriter(TWriter writer) : writer_(writer) {}
+  BufferedWriter(const BufferedWriter&) = delete;
+  BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+  size_t write(uint8_t c) {
+    if (size_ == sizeof(buffer_))
+      flush();
+    buffer_[size_++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    if (n > sizeof(buffer_) - size_) {
+      flush();
+      if (n >= sizeof(buffer_))  // too big for the block: write it directly
+        return writer_.write(s, n);
+    }
+    memcpy(buffer_ + size_, s, n);
+    size_ += n;
+    return n;
+  }
+
+  void flush() {
+    if (size_ > 0)
+      lost_ += size_ - writer_.write(buffer_, size_);
+    size_ = 0;
+  }
+
+  // Returns the number of buffered bytes that the destination rejected
+  size_t lost() const {
+    return lost_;
+  }
+
+ private:
+  TWriter writer_;
+  size_t size_ = 0;
+  size_t lost_ = 0;
+  uint8_t buffer_[ARDUINOJSON_WRITER_BUFFER_SIZE];
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
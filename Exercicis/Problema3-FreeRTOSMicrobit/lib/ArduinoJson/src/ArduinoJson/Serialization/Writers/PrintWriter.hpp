@@ -26,4 +26,12 @@ class Writer<TDestination,
   ::Print* print_;
 };
 
+#if ARDUINOJSON_WRITER_BUFFER_SIZE > 0
+// Print::write() is virtual, and often takes a lock
+template <typename TDestination>
+struct IsBufferableWriter<Writer<
+    TDestination, enable_if_t<is_base_of<::Print, TDestination>::value>>>
+    : true_type {};
+#endif
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -16,11 +16,27 @@ size_t doSerialize(ArduinoJson::JsonVariantConst source, TWriter writer) {
   return VariantData::accept(data, resources, serializer);
 }
 
+template <template <typename> class TSerializer, typename TWriter,
+          enable_if_t<!IsBufferableWriter<TWriter>::value, int> = 0>
+size_t serializeWriter(ArduinoJson::JsonVariantConst source, TWriter writer) {
+  return doSerialize<TSerializer>(source, writer);
+}
+
+template <template <typename> class TSerializer, typename TWriter,
+          enable_if_t<IsBufferableWriter<TWriter>::value, int> = 0>
+size_t serializeWriter(ArduinoJson::JsonVariantConst source, TWriter writer) {
+  BufferedWriter<TWriter> bufferedWriter(writer);
+  size_t n = doSerialize<TSerializer>(
+      source, Writer<BufferedWriter<TWriter>>(bufferedWriter));
+  bufferedWriter.flush();
+  return n - bufferedWriter.lost();
+}
+
 template <template <typename> class TSerializer, typename TDestination>
 size_t serialize(ArduinoJson::JsonVariantConst source,
                  TDestination& destination) {
-  Writer<TDestination> writer(destination);
-  return doSerialize<TSerializer>(source, writer);
+  return serializeWriter<TSerializer>(source,
+                                      Writer<TDestination>(destination));
 }
 
 template <template <typename> class TSerializer>
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ArduinoJson/Polyfills/integer.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 #include <ArduinoJson/Strings/Adapters/RamString.hpp>
 #include <ArduinoJson/Strings/Adapters/StringObject.hpp>
@@ -69,4 +70,17 @@ static void stringGetChars(TAdaptedString s, char* p, size_t n) {
   }
 }
 
+// 32-bit FNV-1a hash, used by the lookup indexes
+template <typename TAdaptedString>
+uint32_t stringHash(TAdaptedString s) {
+  ARDUINOJSON_ASSERT(!s.isNull());
+  uint32_t hash = 2166136261u;
+  size_t n = s.size();
+  for (size_t i = 0; i < n; i++) {
+    hash ^= static_cast<uint8_t>(s[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,180 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/ArrayData.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Object/ObjectData.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+#include <ArduinoJson/Variant/JsonVariant.hpp>
+
+#include <string.h>  // strlen
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// One reference token of a JsonPointer
+struct PointerStep {
+  static const size_t noIndex = size_t(-1);
+
+  size_t keyOffset;
+  size_t keyLength;
+  size_t index;  // the token as an array index, or noIndex
+  size_t hint;   // the position of the member found by the previous query
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A JSON Pointer (RFC 6901), like "/status/motors/1/pwm", parsed once into
+// decoded keys and array indexes.
+// Each step remembers the position of the member it found last time. In a
+// frozen document, resolve() jumps straight to that member. In other
+// documents, it still walks the members that precede it, unless the object
+// index covers the object, but it doesn't compare their keys. So the gain is
+// small unless the document is frozen.
+// resolve() updates these hints, so it isn't const, and a JsonPointer must not
+// be shared between threads.
+class JsonPointer {
+ public:
+  explicit JsonPointer(
+      const char* pointer,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : allocator_(allocator) {
+    if (!pointer || (*pointer && *pointer != '/'))
+      return;
+
+    // a step for each '/', and the key bytes never outgrow the pointer
+    size_t length = strlen(pointer);
+    for (const char* p = pointer; *p; p++)
+      if (*p == '/')
+        count_++;
+    if (count_ == 0) {  // "" is the whole document
+      valid_ = true;
+      return;
+    }
+
+    size_t stepsSize = count_ * sizeof(detail::PointerStep);
+    auto block = static_cast<char*>(allocator_->allocate(stepsSize + length));
+    if (!block)
+      return;
+    steps_ = reinterpret_cast<detail::PointerStep*>(block);
+    keys_ = block + stepsSize;
+    valid_ = parse(pointer);
+  }
+
+  JsonPointer(const JsonPointer&) = delete;
+  JsonPointer& operator=(const JsonPointer&) = delete;
+
+  ~JsonPointer() {
+    if (steps_)
+      allocator_->deallocate(steps_);
+  }
+
+  // Returns false if the pointer is malformed, or if the steps couldn't be
+  // allocated. In that case, resolve() always returns null.
+  bool isValid() const {
+    return valid_;
+  }
+
+  // Returns the number of reference tokens
+  size_t size() const {
+    return valid_ ? count_ : 0;
+  }
+
+  // Returns the value the pointer refers to, or null if there is none
+  JsonVariantConst resolve(JsonVariantConst root) {
+    auto resources = detail::VariantAttorney::getResourceManager(root);
+    return JsonVariantConst(
+        find(detail::VariantAttorney::getData(root), resources), resources);
+  }
+
+  // Returns the value the pointer refers to, or null if there is none
+  JsonVariant resolve(JsonVariant root) {
+    auto resources = detail::VariantAttorney::getResourceManager(root);
+    return JsonVariant(
+        find(detail::VariantAttorney::getData(root), resources), resources);
+  }
+
+  JsonVariant resolve(JsonDocument& doc) {
+    return resolve(doc.as<JsonVariant>());
+  }
+
+  JsonVariantConst resolve(const JsonDocument& doc) {
+    return resolve(doc.as<JsonVariantConst>());
+  }
+
+ private:
+  bool parse(const char* pointer) {
+    size_t keyBytes = 0;
+    auto step = steps_;
+    for (const char* p = pointer; *p; step++) {
+      p++;  // skip '/'
+      step->keyOffset = keyBytes;
+      step->hint = 0;
+      for (; *p && *p != '/'; p++) {
+        char c = *p;
+        if (c == '~') {
+          p++;
+          if (*p == '0')
+            c = '~';
+          else if (*p == '1')
+            c = '/';
+          else
+            return false;
+        }
+        keys_[keyBytes++] = c;
+      }
+      step->keyLength = keyBytes - step->keyOffset;
+      step->index = parseIndex(keys_ + step->keyOffset, step->keyLength);
+    }
+    return true;
+  }
+
+  // "0", "1", "42"... but not "01", "-", or "1e3"
+  static size_t parseIndex(const char* s, size_t n) {
+    if (n == 0 || (n > 1 && s[0] == '0'))
+      return detail::PointerStep::noIndex;
+    size_t index = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (s[i] < '0' || s[i] > '9')
+        return detail::PointerStep::noIndex;
+      size_t digit = size_t(s[i] - '0');
+      if (index > (detail::PointerStep::noIndex - 1 - digit) / 10)
+        return detail::PointerStep::noIndex;
+      index = index * 10 + digit;
+    }
+    return index;
+  }
+
+  detail::VariantData* find(const detail::VariantData* data,
+                            const detail::ResourceManager* resources) {
+    if (!valid_ || !data)
+      return nullptr;
+    using namespace detail;
+    auto value = const_cast<VariantData*>(data);
+    for (size_t i = 0; value && i < count_; i++) {
+      auto& step = steps_[i];
+      if (value->isObject())
+        value = value->asObject()->getMember(
+            adaptString(keys_ + step.keyOffset, step.keyLength), step.hint,
+            resources);
+      else if (value->isArray() && step.index != PointerStep::noIndex)
+        value = value->asArray()->getElement(step.index, resources);
+      else
+        value = nullptr;
+    }
+    return value;
+  }
+
+  Allocator* allocator_;
+  detail::PointerStep* steps_ = nullptr;
+  char* keys_ = nullptr;
+  size_t count_ = 0;
+  bool valid_ = false;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -74,6 +74,10 @@ class VariantData {
         return visit.visit(RawString(content_.asOwnedString->data,
                                      content_.asOwnedString->length));
 
+      case VariantType::LinkedRawString:
+        return visit.visit(RawString(content_.asLinkedString,
+                                     linkedRawStringSize()));
+
       case VariantType::Int32:
         return visit.visit(static_cast<JsonInteger>(content_.asInt32));
 
@@ -261,6 +265,8 @@ class VariantData {
       case VariantType::RawString:
         return JsonString(content_.asOwnedString->data,
                           content_.asOwnedString->length);
+      case VariantType::LinkedRawString:
+        return JsonString(content_.asLinkedString, linkedRawStringSize());
       default:
         return JsonString();
     }
@@ -280,6 +286,12 @@ class VariantData {
 
 #if ARDUINOJSON_USE_EXTENSIONS
   const VariantExtension* getExtension(const ResourceManager* resources) const;
+
+  // Points to the extension after ResourceManager::freeze() moved it
+  void moveExtension(SlotId id) {
+    ARDUINOJSON_ASSERT(type_ & VariantTypeBits::ExtensionBit);
+    content_.asSlotId = id;
+  }
 #endif
 
   VariantData* getElement(size_t index,
@@ -323,6 +335,14 @@ class VariantData {
     return obj->getOrAddMember(key, resources);
   }
 
+  // Indexes the array or the object, so that lookups don't walk it
+  void buildIndex(ResourceManager* resources) {
+    if (isArray())
+      ArrayData::buildIndex(asArray(), resources);
+    else
+      ObjectData::buildIndex(asObject(), resources);
+  }
+
   bool isArray() const {
     return type_ == VariantType::Array;
   }
@@ -460,6 +480,14 @@ class VariantData {
     content_.asOwnedString = s;
   }
 
+  // Links a MessagePack bin or ext that stays in the input buffer
+  void setLinkedRawString(const char* s) {
+    ARDUINOJSON_ASSERT(type_ == VariantType::Null);  // must call clear() first
+    ARDUINOJSON_ASSERT(s);
+    type_ = VariantType::LinkedRawString;
+    content_.asLinkedString = s;
+  }
+
   template <typename T>
   void setRawString(SerializedValue<T> value, ResourceManager* resources);
 
@@ -557,6 +585,23 @@ class VariantData {
       return;
     var->clear(resources);
   }
+
+ private:
+  // A linked raw string is a MessagePack bin or ext, so it starts with its
+  // size: 0xc4-0xc6 bin 8/16/32, 0xc7-0xc9 ext 8/16/32, 0xd4-0xd8 fixext
+  size_t linkedRawStringSize() const {
+    auto p = reinterpret_cast<const uint8_t*>(content_.asLinkedString);
+    ARDUINOJSON_ASSERT((p[0] >= 0xc4 && p[0] <= 0xc9) ||
+                       (p[0] >= 0xd4 && p[0] <= 0xd8));
+    if (p[0] >= 0xd4)  // code + type + data
+      return 2 + (size_t(1) << (p[0] - 0xd4));
+    uint8_t sizeBytes = uint8_t(1U << ((p[0] - 0xc4) % 3));
+    size_t size = 0;
+    for (uint8_t i = 1; i <= sizeBytes; i++)
+      size = (size << 8) | p[i];
+    size_t headerSize = 1U + sizeBytes + (p[0] >= 0xc7 ? 1U : 0U);
+    return headerSize + size;
+  }
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE